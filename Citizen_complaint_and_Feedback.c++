@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <iomanip>
 #include <fstream>
+#include "Write_ahead_log.h"
 
 using namespace std;
 
@@ -33,6 +34,7 @@ private:
     map<string, int> adminResolvedCount;                   // Track number of complaints resolved by each admin
     int totalComplaintsSubmitted;
     int totalComplaintsResolved;
+    WalStore store; // keys: "stats", "admin:<name>", "complaint:<citizen>"
 
     // Helper: Validate Area
     bool validateArea(const string &area) {
@@ -55,42 +57,66 @@ private:
         }
     }
 
-    // Helper: Save complaints to a file
-    void saveComplaintsToFile() {
-        ofstream outFile("complaints.txt");
-        if (outFile.is_open()) {
-            outFile << totalComplaintsSubmitted << " " << totalComplaintsResolved << "\n";
-            for (const auto &entry : areaComplaints) {
-                const auto &area = entry.first;
-                const auto &complaints = entry.second;
-                priority_queue<Complaint> tempQueue = complaints;
+    static string encodeComplaint(const Complaint &complaint) {
+        return RecordWriter().putInt(complaint.priority).putString(complaint.citizenName).putString(complaint.area)
+            .putString(complaint.description).putString(complaint.status).putString(complaint.resolvedByAdmin).str();
+    }
 
-                while (!tempQueue.empty()) {
-                    const Complaint &complaint = tempQueue.top();
-                    outFile << complaint.priority << " " << complaint.citizenName << " "
-                            << complaint.area << " " << complaint.description << " "
-                            << complaint.status << " " << complaint.resolvedByAdmin << "\n";
-                    tempQueue.pop();
-                }
+    void saveComplaint(const Complaint &complaint) {
+        store.put("complaint:" + complaint.citizenName, encodeComplaint(complaint));
+    }
+
+    void saveStats() {
+        store.put("stats", RecordWriter().putInt(totalComplaintsSubmitted).putInt(totalComplaintsResolved).str());
+    }
+
+    // Helper: Save complaints to a snapshot
+    void saveComplaintsToFile(WalStore::SnapshotWriter &out) const {
+        out.put("stats", RecordWriter().putInt(totalComplaintsSubmitted).putInt(totalComplaintsResolved).str());
+        for (const auto &entry : adminResolvedCount) {
+            out.put("admin:" + entry.first, RecordWriter().putInt(entry.second).str());
+        }
+        for (const auto &entry : areaComplaints) {
+            priority_queue<Complaint> tempQueue = entry.second;
+            while (!tempQueue.empty()) {
+                out.put("complaint:" + tempQueue.top().citizenName, encodeComplaint(tempQueue.top()));
+                tempQueue.pop();
             }
-            outFile.close();
-        } else {
-            cerr << "Unable to open file for saving complaints.\n";
+        }
+    }
+
+    // Helper: Load complaints from the snapshot and log
+    void loadComplaintsFromFile() {
+        vector<pair<string, string>> records;
+        if (!store.open(records)) {
+            importComplaintsFromTextFile();
+            store.compact();
+            return;
         }
 
-        ofstream adminOutFile("admin_resolved.txt");
-        if (adminOutFile.is_open()) {
-            for (const auto &entry : adminResolvedCount) {
-                adminOutFile << entry.first << " " << entry.second << "\n";
+        for (const auto &record : records) {
+            RecordReader in(record.second);
+            if (record.first == "stats") {
+                totalComplaintsSubmitted = in.getInt();
+                totalComplaintsResolved = in.getInt();
+            } else if (record.first.compare(0, 6, "admin:") == 0) {
+                adminResolvedCount[record.first.substr(6)] = in.getInt();
+            } else {
+                Complaint complaint;
+                complaint.priority = in.getInt();
+                complaint.citizenName = in.getString();
+                complaint.area = in.getString();
+                complaint.description = in.getString();
+                complaint.status = in.getString();
+                complaint.resolvedByAdmin = in.getString();
+                areaComplaints[complaint.area].push(complaint);
+                userComplaints[complaint.citizenName] = complaint.area;
             }
-            adminOutFile.close();
-        } else {
-            cerr << "Unable to open file for saving admin resolved counts.\n";
         }
     }
 
-    // Helper: Load complaints from a file
-    void loadComplaintsFromFile() {
+    // Helper: One-time migration from the old complaints.txt / admin_resolved.txt
+    void importComplaintsFromTextFile() {
         ifstream inFile("complaints.txt");
         if (inFile.is_open()) {
             inFile >> totalComplaintsSubmitted >> totalComplaintsResolved;
@@ -128,14 +154,12 @@ private:
     }
 
 public:
-    ComplaintSystem() : totalComplaintsSubmitted(0), totalComplaintsResolved(0) {
+    ComplaintSystem()
+        : totalComplaintsSubmitted(0), totalComplaintsResolved(0),
+          store("complaints", [this](WalStore::SnapshotWriter &out) { saveComplaintsToFile(out); }) {
         loadComplaintsFromFile();
     }
 
-    ~ComplaintSystem() {
-        saveComplaintsToFile();
-    }
-
     // Submit a new complaint
     void submitComplaint(const string &citizenName, const string &area, const string &description) {
         if (userComplaints.find(citizenName) != userComplaints.end()) {
@@ -147,6 +171,8 @@ public:
         areaComplaints[area].push(newComplaint);
         userComplaints[citizenName] = area;
         totalComplaintsSubmitted++;
+        saveComplaint(newComplaint);
+        saveStats();
 
         cout << "\nComplaint submitted successfully in area: " << area << "!\n";
     }
@@ -164,6 +190,9 @@ public:
         userComplaints.erase(topComplaint.citizenName);
         totalComplaintsResolved++;
         adminResolvedCount[adminName]++;
+        store.erase("complaint:" + topComplaint.citizenName);
+        store.put("admin:" + adminName, RecordWriter().putInt(adminResolvedCount[adminName]).str());
+        saveStats();
 
         cout << "\nResolving complaint in area: " << area << ":\n";
         displayComplaint(topComplaint);
@@ -187,6 +216,7 @@ public:
 
             if (complaint.citizenName == citizenName) {
                 complaint.status = newStatus;
+                saveComplaint(complaint);
                 updated = true;
             }
 
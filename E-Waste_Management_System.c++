@@ -6,6 +6,11 @@
 #include <algorithm>
 #include <set>
 #include <fstream>
+#include <queue>
+#include <chrono>
+#include <iomanip>
+#include "Write_ahead_log.h"
+#include "Flat_containers.h"
 
 using namespace std;
 
@@ -26,250 +31,136 @@ public:
         : id(id), location(loc), eWasteQuantity(qty) {}
 };
 
-// AVL Node for Collection Center
-class AVLNode {
-public:
-    CollectionCenter center;
-    AVLNode *left;
-    AVLNode *right;
-    int height;
-
-    AVLNode(CollectionCenter c)
-        : center(c), left(nullptr), right(nullptr), height(1) {}
-};
-
-// AVL Tree for Managing Collection Centers
-class AVLTree {
+// Collection centers ordered by (ID, Location) in one sorted array. Lookups are a
+// binary search over contiguous entries; an ID's centers sit next to each other.
+class CenterDirectory {
 private:
-    AVLNode *root;
-    set<pair<string, string>> centerKeys; // To track (ID, Location) pairs
-
-    int getHeight(AVLNode *node) {
-        return node ? node->height : 0;
-    }
-
-    int getBalance(AVLNode *node) {
-        return node ? getHeight(node->left) - getHeight(node->right) : 0;
-    }
-
-    AVLNode *rotateRight(AVLNode *y) {
-        AVLNode *x = y->left;
-        AVLNode *T2 = x->right;
-
-        x->right = y;
-        y->left = T2;
-
-        y->height = max(getHeight(y->left), getHeight(y->right)) + 1;
-        x->height = max(getHeight(x->left), getHeight(x->right)) + 1;
+    typedef pair<string, string> CenterKey; // (ID, Location)
+    SortedArrayMap<CenterKey, float> centers; // -> E-Waste quantity
+    WalStore store; // one record per (ID, Location) center
 
-        return x;
+    static string recordKey(const CenterKey &key) {
+        return key.first + '\0' + key.second;
     }
 
-    AVLNode *rotateLeft(AVLNode *x) {
-        AVLNode *y = x->right;
-        AVLNode *T2 = y->left;
-
-        y->left = x;
-        x->right = T2;
-
-        x->height = max(getHeight(x->left), getHeight(x->right)) + 1;
-        y->height = max(getHeight(y->left), getHeight(y->right)) + 1;
-
-        return y;
-    }
-
-    AVLNode *insert(AVLNode *node, CollectionCenter center) {
-        if (!node)
-            return new AVLNode(center);
-
-        if (center.id < node->center.id)
-            node->left = insert(node->left, center);
-        else if (center.id > node->center.id || (center.id == node->center.id && center.location != node->center.location))
-            node->right = insert(node->right, center);
-        else
-            return node;
-
-        node->height = max(getHeight(node->left), getHeight(node->right)) + 1;
-
-        int balance = getBalance(node);
-
-        if (balance > 1 && center.id < node->left->center.id)
-            return rotateRight(node);
-
-        if (balance < -1 && center.id > node->right->center.id)
-            return rotateLeft(node);
-
-        if (balance > 1 && center.id > node->left->center.id) {
-            node->left = rotateLeft(node->left);
-            return rotateRight(node);
-        }
-
-        if (balance < -1 && center.id < node->right->center.id) {
-            node->right = rotateRight(node->right);
-            return rotateLeft(node);
-        }
-
-        return node;
+    static string encodeCenter(const CenterKey &key, float quantity) {
+        return RecordWriter().putString(key.first).putString(key.second).putDouble(quantity).str();
     }
 
-    AVLNode *getMinValueNode(AVLNode *node) {
-        AVLNode *current = node;
-        while (current && current->left)
-            current = current->left;
-        return current;
+    void saveCenter(const CenterKey &key, float quantity) {
+        store.put(recordKey(key), encodeCenter(key, quantity));
     }
 
-    AVLNode *deleteNode(AVLNode *root, string id) {
-        if (!root)
-            return root;
-
-        if (id < root->center.id)
-            root->left = deleteNode(root->left, id);
-        else if (id > root->center.id)
-            root->right = deleteNode(root->right, id);
-        else {
-            centerKeys.erase({root->center.id, root->center.location});
-
-            if (!root->left || !root->right) {
-                AVLNode *temp = root->left ? root->left : root->right;
-                if (!temp) {
-                    temp = root;
-                    root = nullptr;
-                } else {
-                    *root = *temp;
-                }
-                delete temp;
-            } else {
-                AVLNode *temp = getMinValueNode(root->right);
-                root->center = temp->center;
-                root->right = deleteNode(root->right, temp->center.id);
-            }
-        }
-
-        if (!root)
-            return root;
-
-        root->height = max(getHeight(root->left), getHeight(root->right)) + 1;
-        int balance = getBalance(root);
-
-        if (balance > 1 && getBalance(root->left) >= 0)
-            return rotateRight(root);
-        if (balance > 1 && getBalance(root->left) < 0) {
-            root->left = rotateLeft(root->left);
-            return rotateRight(root);
-        }
-        if (balance < -1 && getBalance(root->right) <= 0)
-            return rotateLeft(root);
-        if (balance < -1 && getBalance(root->right) > 0) {
-            root->right = rotateRight(root->right);
-            return rotateLeft(root);
-        }
-
-        return root;
+    // Index of the first center with this ID, or centers.size() if there is none
+    size_t findById(const string &id) const {
+        size_t at = centers.lowerBound(CenterKey(id, ""));
+        return at < centers.size() && centers.entryAt(at).first.first == id ? at : centers.size();
     }
 
-    void inOrderTraversal(AVLNode *node) {
-        if (node) {
-            inOrderTraversal(node->left);
-            cout << "Center ID: " << node->center.id << ", Location: " << node->center.location
-                 << ", E-Waste Quantity: " << node->center.eWasteQuantity << " kg\n";
-            inOrderTraversal(node->right);
+    void saveCenters(WalStore::SnapshotWriter &out) const {
+        for (const auto &entry : centers) {
+            out.put(recordKey(entry.first), encodeCenter(entry.first, entry.second));
         }
     }
 
 public:
-    AVLTree() : root(nullptr) {
+    CenterDirectory() : store("centers", [this](WalStore::SnapshotWriter &out) { saveCenters(out); }) {
         loadCentersFromFile();
     }
 
-    ~AVLTree() {
-        saveCentersToFile();
-    }
-
     bool addCenter(CollectionCenter center) {
-        auto key = make_pair(center.id, center.location);
-        if (centerKeys.find(key) != centerKeys.end()) {
-            AVLNode *current = root;
-            while (current) {
-                if (current->center.id == center.id && current->center.location == center.location) {
-                    current->center.eWasteQuantity += center.eWasteQuantity;
-                    cout << "Center ID and Location already exist. Adding E-Waste Quantity.\n";
-                    return true;
-                }
-                current = (center.id < current->center.id) ? current->left : current->right;
-            }
-            return false;
-        }
-        centerKeys.insert(key);
-        root = insert(root, center);
+        CenterKey key(center.id, center.location);
+        auto inserted = centers.insert(key, center.eWasteQuantity);
+        if (!inserted.second) {
+            *inserted.first += center.eWasteQuantity;
+            saveCenter(key, *inserted.first);
+            cout << "Center ID and Location already exist. Adding E-Waste Quantity.\n";
+            return true;
+        }
+        saveCenter(key, center.eWasteQuantity);
         cout << "Collection Center added successfully.\n";
         return true;
     }
 
+    // Removes every center registered under the ID
     void removeCenter(string id) {
-        if (centerKeys.find({id, ""}) == centerKeys.end()) {
+        size_t at = findById(id);
+        if (at == centers.size()) {
             cout << "Error: Center ID does not exist.\n";
             return;
         }
-        root = deleteNode(root, id);
+        while (at < centers.size() && centers.entryAt(at).first.first == id) {
+            CenterKey removed = centers.entryAt(at).first;
+            centers.eraseAt(at);
+            store.erase(recordKey(removed));
+        }
+        cout << "Collection center removed successfully.\n";
     }
 
     void displayCenters() {
-        if (!root) {
+        if (centers.empty()) {
             cout << "No collection centers available.\n";
             return;
         }
-        inOrderTraversal(root);
+        for (const auto &entry : centers) {
+            cout << "Center ID: " << entry.first.first << ", Location: " << entry.first.second
+                 << ", E-Waste Quantity: " << entry.second << " kg\n";
+        }
     }
 
     bool modifyCenter(string id, string newLocation, float newQuantity) {
-        AVLNode *current = root;
-        while (current) {
-            if (current->center.id == id) {
-                current->center.location = newLocation;
-                current->center.eWasteQuantity = newQuantity;
-                cout << "Collection center details updated successfully.\n";
-                return true;
-            }
-            current = (id < current->center.id) ? current->left : current->right;
+        size_t at = findById(id);
+        if (at == centers.size()) {
+            cout << "Error: Collection center not found.\n";
+            return false;
         }
-        cout << "Error: Collection center not found.\n";
-        return false;
+        CenterKey previous = centers.entryAt(at).first;
+        centers.eraseAt(at);
+        store.erase(recordKey(previous));
+
+        CenterKey key(id, newLocation);
+        auto inserted = centers.insert(key, newQuantity);
+        *inserted.first = newQuantity;
+        saveCenter(key, newQuantity);
+        cout << "Collection center details updated successfully.\n";
+        return true;
     }
 
-    void saveCentersToFile() {
-        ofstream outFile("centers.txt");
-        if (outFile.is_open()) {
-            saveCenters(outFile, root);
-            outFile.close();
-        } else {
-            cerr << "Unable to open file for saving centers.\n";
+    void loadCentersFromFile() {
+        vector<pair<string, string>> records;
+        if (!store.open(records)) {
+            importCentersFromTextFile();
+            store.compact();
+            return;
+        }
+
+        vector<pair<CenterKey, float>> loaded;
+        for (const auto &record : records) {
+            RecordReader in(record.second);
+            string id = in.getString();
+            string location = in.getString();
+            float quantity = in.getDouble();
+            loaded.push_back(make_pair(CenterKey(id, location), quantity));
         }
+        centers.assign(loaded);
     }
 
-    void loadCentersFromFile() {
+    // One-time migration from the old space-delimited centers.txt
+    void importCentersFromTextFile() {
         ifstream inFile("centers.txt");
         if (inFile.is_open()) {
+            vector<pair<CenterKey, float>> loaded;
             string id, location;
             float quantity;
             while (inFile >> id >> location >> quantity) {
-                CollectionCenter center(id, location, quantity);
-                addCenter(center);
+                loaded.push_back(make_pair(CenterKey(id, location), quantity));
             }
+            centers.assign(loaded);
             inFile.close();
         } else {
             cerr << "Unable to open file for loading centers.\n";
         }
     }
-
-private:
-    void saveCenters(ofstream &outFile, AVLNode *node) {
-        if (node) {
-            saveCenters(outFile, node->left);
-            outFile << node->center.id << " " << node->center.location << " " << node->center.eWasteQuantity << "\n";
-            saveCenters(outFile, node->right);
-        }
-    }
 };
 
 // Graph for Routes between Centers
@@ -277,15 +168,34 @@ class Graph {
 private:
     map<string, vector<pair<string, double>>> adjList;
     map<string, string> locationMap; // Maps ID to Location
+    WalStore store; // "route:<id>" adjacency lists and "location:<id>" names
+
+    string encodeRoutes(const vector<pair<string, double>> &routes) const {
+        RecordWriter out;
+        out.putInt(routes.size());
+        for (const auto &neighbor : routes) {
+            out.putString(neighbor.first).putDouble(neighbor.second);
+        }
+        return out.str();
+    }
+
+    void saveRoutes(const string &id) {
+        store.put("route:" + id, encodeRoutes(adjList[id]));
+    }
 
 public:
+    Graph() : store("routes", [this](WalStore::SnapshotWriter &out) { saveRoutesToFile(out); }) {
+        loadRoutesFromFile();
+    }
+
     void addEdge(string u, string v, double weight) {
         if (u == v) {
             return; // Ignore routes where the two centers are the same
         }
         adjList[u].push_back({v, weight});
         adjList[v].push_back({u, weight});
-        saveRoutesToFile();
+        saveRoutes(u);
+        saveRoutes(v);
     }
 
     void displayGraph() {
@@ -300,33 +210,28 @@ public:
     void shortestPath(string start, string end) {
         map<string, double> dist;
         map<string, string> parent;
-        map<string, bool> visited;
+        typedef pair<double, string> HeapEntry; // (distance, center)
+        priority_queue<HeapEntry, vector<HeapEntry>, greater<HeapEntry>> heap;
 
         for (auto &node : adjList) {
             dist[node.first] = numeric_limits<double>::max();
-            visited[node.first] = false;
         }
         dist[start] = 0;
-
-        for (size_t i = 0; i < adjList.size(); ++i) {
-            string minNode;
-            double minDist = numeric_limits<double>::max();
-
-            for (auto &node : dist) {
-                if (!visited[node.first] && node.second < minDist) {
-                    minDist = node.second;
-                    minNode = node.first;
-                }
-            }
-
-            if (minNode.empty())
+        heap.push({0, start});
+
+        while (!heap.empty()) {
+            HeapEntry top = heap.top();
+            heap.pop();
+            if (top.first > dist[top.second])
+                continue; // stale entry
+            if (top.second == end)
                 break;
-            visited[minNode] = true;
 
-            for (auto &neighbor : adjList[minNode]) {
-                if (dist[minNode] + neighbor.second < dist[neighbor.first]) {
-                    dist[neighbor.first] = dist[minNode] + neighbor.second;
-                    parent[neighbor.first] = minNode;
+            for (auto &neighbor : adjList[top.second]) {
+                if (top.first + neighbor.second < dist[neighbor.first]) {
+                    dist[neighbor.first] = top.first + neighbor.second;
+                    parent[neighbor.first] = top.second;
+                    heap.push({dist[neighbor.first], neighbor.first});
                 }
             }
         }
@@ -368,7 +273,8 @@ public:
         }
         if (routeFound) {
             cout << "Route between " << locationMap[u] << " and " << locationMap[v] << " updated successfully.\n";
-            saveRoutesToFile();
+            saveRoutes(u);
+            saveRoutes(v);
         } else {
             cout << "Error: Route not found.\n";
         }
@@ -376,29 +282,51 @@ public:
 
     void addLocation(string id, string location) {
         locationMap[id] = location;
+        store.put("location:" + id, location);
+    }
+
+    void saveRoutesToFile(WalStore::SnapshotWriter &out) const {
+        for (const auto &node : adjList) {
+            out.put("route:" + node.first, encodeRoutes(node.second));
+        }
+        for (const auto &location : locationMap) {
+            out.put("location:" + location.first, location.second);
+        }
     }
 
-    void saveRoutesToFile() {
-        ofstream outFile("routes.txt");
-        if (outFile.is_open()) {
-            for (const auto &node : adjList) {
-                for (const auto &neighbor : node.second) {
-                    outFile << node.first << " " << neighbor.first << " " << neighbor.second << "\n";
+    void loadRoutesFromFile() {
+        vector<pair<string, string>> records;
+        if (!store.open(records)) {
+            importRoutesFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records) {
+            const string &key = record.first;
+            if (key.compare(0, 9, "location:") == 0) {
+                locationMap[key.substr(9)] = record.second;
+            } else if (key.compare(0, 6, "route:") == 0) {
+                RecordReader in(record.second);
+                vector<pair<string, double>> &routes = adjList[key.substr(6)];
+                routes.clear();
+                for (long long count = in.getInt(); count > 0; count--) {
+                    string neighbor = in.getString();
+                    routes.push_back({neighbor, in.getDouble()});
                 }
             }
-            outFile.close();
-        } else {
-            cerr << "Unable to open file for saving routes.\n";
         }
     }
 
-    void loadRoutesFromFile() {
+    // One-time migration from the old routes.txt, which lists every route
+    // once per direction
+    void importRoutesFromTextFile() {
         ifstream inFile("routes.txt");
         if (inFile.is_open()) {
             string u, v;
             double weight;
             while (inFile >> u >> v >> weight) {
-                addEdge(u, v, weight);
+                adjList[u].push_back({v, weight});
             }
             inFile.close();
         } else {
@@ -438,7 +366,7 @@ public:
 };
 
 // Function to display the admin menu and handle admin operations
-void adminMenu(AVLTree &centerManager, Graph &routeManager, const string &loggedInAdmin) {
+void adminMenu(CenterDirectory &centerManager, Graph &routeManager, const string &loggedInAdmin) {
     int choice;
     do {
         cout << "\nAdmin Menu:\n";
@@ -540,7 +468,7 @@ void adminMenu(AVLTree &centerManager, Graph &routeManager, const string &logged
 }
 
 // Function to display the user menu and handle user operations
-void userMenu(AVLTree &centerManager, Graph &routeManager) {
+void userMenu(CenterDirectory &centerManager, Graph &routeManager) {
     int choice;
     do {
         cout << "\nUser Menu:\n";
@@ -576,9 +504,71 @@ void userMenu(AVLTree &centerManager, Graph &routeManager) {
     } while (choice != 4);
 }
 
+// --bench-centers [max]: center lookups by ID, node-based balanced tree vs the
+// sorted array, for 10k centers up to max (default 1M) in steps of 10x. std::map
+// stands in for the old AVLTree: same shape, one heap node per center.
+void runCenterLookupBenchmark(size_t maxEntries) {
+    typedef pair<string, string> CenterKey;
+    typedef chrono::steady_clock Clock;
+    auto secondsSince = [](Clock::time_point start) {
+        return chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    cout << "Center lookup benchmark\n";
+    cout << left << setw(10) << "entries" << setw(24) << "tree lookups/s" << setw(12) << "heap MB" << setw(24)
+         << "sorted array lookups/s" << "heap MB\n";
+    for (size_t n = 10000; n <= maxEntries; n *= 10) {
+        vector<pair<CenterKey, float>> generated(n);
+        for (size_t i = 0; i < n; i++) {
+            generated[i] = make_pair(CenterKey("C" + to_string(i * 7919 % (n * 10)), "Ward" + to_string(i % 97)), 1.0f);
+        }
+        vector<CenterKey> probes;
+        for (size_t i = 0; i < 4096; i++) {
+            probes.push_back(CenterKey("C" + to_string((i * 104729) % (n * 10)), ""));
+        }
+        const size_t lookups = 2000000;
+        size_t hits = 0;
+
+        size_t heapBefore = heapBytesInUse();
+        map<CenterKey, float> *tree = new map<CenterKey, float>(generated.begin(), generated.end());
+        double treeMegabytes = (heapBytesInUse() - heapBefore) / 1048576.0;
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < lookups; i++) {
+            const CenterKey &probe = probes[i % probes.size()];
+            auto found = tree->lower_bound(probe);
+            hits += found != tree->end() && found->first.first == probe.first;
+        }
+        double treeRate = lookups / secondsSince(start);
+        delete tree;
+
+        heapBefore = heapBytesInUse();
+        SortedArrayMap<CenterKey, float> *flat = new SortedArrayMap<CenterKey, float>();
+        flat->assign(generated);
+        double flatMegabytes = (heapBytesInUse() - heapBefore) / 1048576.0;
+        start = Clock::now();
+        for (size_t i = 0; i < lookups; i++) {
+            const CenterKey &probe = probes[i % probes.size()];
+            size_t at = flat->lowerBound(probe);
+            hits += at < flat->size() && flat->entryAt(at).first.first == probe.first;
+        }
+        double flatRate = lookups / secondsSince(start);
+        delete flat;
+
+        cout << fixed << setprecision(0) << setw(10) << n << setw(24) << treeRate << setprecision(1) << setw(12)
+             << treeMegabytes << setprecision(0) << setw(24) << flatRate << setprecision(1) << flatMegabytes << "\n";
+        if (hits == 0)
+            cout << "(no hits)\n";
+    }
+}
+
 // Main Function
-int main() {
-    AVLTree centerManager;
+int main(int argc, char *argv[]) {
+    if (argc > 1 && string(argv[1]) == "--bench-centers") {
+        runCenterLookupBenchmark(argc > 2 ? stoull(argv[2]) : 1000000);
+        return 0;
+    }
+
+    CenterDirectory centerManager;
     Graph routeManager;
     LoginSystem loginSystem;
 
@@ -0,0 +1,297 @@
+// Flat_containers.h
+// Cache-friendly replacements for node-per-entry containers. Everything lives in a
+// few contiguous arrays and refers to other entries by index, so a lookup touches
+// a handful of cache lines instead of chasing one heap pointer per step.
+//
+//   StringArena     append-only character storage addressed by 32-bit offsets
+//   SortedArrayMap  ordered map as a sorted vector (binary search, ordered scans)
+//   PerfectHashSet  static string set; a lookup is two array reads and one compare
+#ifndef FLAT_CONTAINERS_H
+#define FLAT_CONTAINERS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+// Bump allocator for strings: one growing buffer, released all at once
+class StringArena {
+private:
+    std::vector<char> bytes;
+
+public:
+    uint32_t add(const char *text, size_t length) {
+        if (bytes.size() + length > UINT32_MAX)
+            throw std::length_error("StringArena: more than 4 GB of text");
+        uint32_t offset = bytes.size();
+        bytes.insert(bytes.end(), text, text + length);
+        return offset;
+    }
+
+    const char *at(uint32_t offset) const {
+        return bytes.data() + offset;
+    }
+
+    void clear() {
+        bytes.clear();
+    }
+
+    void reserve(size_t length) {
+        bytes.reserve(length);
+    }
+
+    size_t memoryBytes() const {
+        return bytes.capacity();
+    }
+};
+
+// Ordered map stored as a sorted vector of (key, value). Inserts and erases shift
+// the tail, which is cheap for the small, read-mostly tables it is used for.
+template <typename Key, typename Value>
+class SortedArrayMap {
+public:
+    typedef std::pair<Key, Value> Entry;
+    typedef typename std::vector<Entry>::const_iterator const_iterator;
+
+private:
+    std::vector<Entry> entries;
+
+    static bool keyLess(const Entry &entry, const Key &key) {
+        return entry.first < key;
+    }
+
+public:
+    size_t size() const {
+        return entries.size();
+    }
+
+    bool empty() const {
+        return entries.empty();
+    }
+
+    const_iterator begin() const {
+        return entries.begin();
+    }
+
+    const_iterator end() const {
+        return entries.end();
+    }
+
+    // Index of the first entry whose key is not less than key
+    size_t lowerBound(const Key &key) const {
+        return std::lower_bound(entries.begin(), entries.end(), key, keyLess) - entries.begin();
+    }
+
+    const Entry &entryAt(size_t index) const {
+        return entries[index];
+    }
+
+    Value &valueAt(size_t index) {
+        return entries[index].second;
+    }
+
+    Value *find(const Key &key) {
+        size_t at = lowerBound(key);
+        return at < entries.size() && !(key < entries[at].first) ? &entries[at].second : nullptr;
+    }
+
+    // Inserts or returns the existing value; second is false if the key was present
+    std::pair<Value *, bool> insert(const Key &key, const Value &value) {
+        size_t at = lowerBound(key);
+        if (at < entries.size() && !(key < entries[at].first))
+            return std::make_pair(&entries[at].second, false);
+        entries.insert(entries.begin() + at, Entry(key, value));
+        return std::make_pair(&entries[at].second, true);
+    }
+
+    bool erase(const Key &key) {
+        size_t at = lowerBound(key);
+        if (at == entries.size() || key < entries[at].first)
+            return false;
+        entries.erase(entries.begin() + at);
+        return true;
+    }
+
+    void eraseAt(size_t index) {
+        entries.erase(entries.begin() + index);
+    }
+
+    // Bulk load: sort once instead of shifting on every insert. Later duplicates
+    // of a key are dropped.
+    void assign(std::vector<Entry> unsorted) {
+        std::stable_sort(unsorted.begin(), unsorted.end(), [](const Entry &a, const Entry &b) {
+            return a.first < b.first;
+        });
+        unsorted.erase(std::unique(unsorted.begin(), unsorted.end(), [](const Entry &a, const Entry &b) {
+            return !(a.first < b.first) && !(b.first < a.first);
+        }), unsorted.end());
+        entries.swap(unsorted);
+    }
+};
+
+// Static set of strings with a perfect hash (hash-and-displace). Keys are hashed
+// once; the hash picks a bucket, and the bucket's seed remixes it into a table
+// slot that no other key uses. Membership is therefore one slot read and a single
+// string compare, hit or miss. Built in O(n); rebuild to change the contents.
+class PerfectHashSet {
+private:
+    enum : uint32_t { EMPTY_SLOT = UINT32_MAX };
+
+    StringArena text;
+    std::vector<uint32_t> keyOffsets; // key k is text[keyOffsets[k], keyOffsets[k + 1])
+    std::vector<uint32_t> seeds;      // per bucket
+    std::vector<uint32_t> slots;      // key index, or EMPTY_SLOT
+    uint64_t salt;
+
+    static uint64_t mix(uint64_t x) {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    uint64_t hashOf(const char *key, size_t length) const {
+        uint64_t hash = 1469598103934665603ULL ^ salt;
+        for (size_t i = 0; i < length; i++)
+            hash = (hash ^ (unsigned char)key[i]) * 1099511628211ULL;
+        return mix(hash);
+    }
+
+    size_t slotOf(uint64_t hash, uint32_t seed) const {
+        return mix(hash ^ (seed * 0x9e3779b97f4a7c15ULL)) % slots.size();
+    }
+
+    size_t bucketOf(uint64_t hash) const {
+        return (hash >> 32) % seeds.size();
+    }
+
+    // One placement attempt with the current salt; false if some bucket cannot be placed
+    bool place(const std::vector<uint64_t> &hashes) {
+        size_t n = hashes.size();
+        seeds.assign(n / 4 + 1, 0);
+        slots.assign(n + n / 4 + 1, EMPTY_SLOT);
+
+        // Counting sort of keys by bucket, then place the largest buckets first
+        std::vector<uint32_t> bucketStart(seeds.size() + 1, 0), members(n);
+        for (uint32_t k = 0; k < n; k++)
+            bucketStart[bucketOf(hashes[k]) + 1]++;
+        for (size_t b = 0; b < seeds.size(); b++)
+            bucketStart[b + 1] += bucketStart[b];
+        std::vector<uint32_t> fill(bucketStart.begin(), bucketStart.end() - 1);
+        for (uint32_t k = 0; k < n; k++)
+            members[fill[bucketOf(hashes[k])]++] = k;
+
+        std::vector<uint32_t> order(seeds.size());
+        for (uint32_t b = 0; b < order.size(); b++)
+            order[b] = b;
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return bucketStart[a + 1] - bucketStart[a] > bucketStart[b + 1] - bucketStart[b];
+        });
+
+        std::vector<size_t> chosen;
+        for (uint32_t b : order) {
+            const uint32_t *first = members.data() + bucketStart[b], *last = members.data() + bucketStart[b + 1];
+            if (first == last)
+                break;
+            bool placed = false;
+            for (uint32_t seed = 0; seed < (1u << 16) && !placed; seed++) {
+                chosen.clear();
+                placed = true;
+                for (const uint32_t *k = first; k != last; k++) {
+                    size_t slot = slotOf(hashes[*k], seed);
+                    if (slots[slot] != EMPTY_SLOT || std::find(chosen.begin(), chosen.end(), slot) != chosen.end()) {
+                        placed = false;
+                        break;
+                    }
+                    chosen.push_back(slot);
+                }
+                if (placed) {
+                    seeds[b] = seed;
+                    for (size_t i = 0; i < chosen.size(); i++)
+                        slots[chosen[i]] = first[i];
+                }
+            }
+            if (!placed)
+                return false; // two keys share a 64-bit hash; retry with another salt
+        }
+        return true;
+    }
+
+    bool keyAt(uint32_t k, const char *key, size_t length) const {
+        uint32_t begin = keyOffsets[k], end = keyOffsets[k + 1];
+        return end - begin == length && (length == 0 || memcmp(text.at(begin), key, length) == 0);
+    }
+
+public:
+    PerfectHashSet() : salt(0) {
+        build(std::vector<std::string>());
+    }
+
+    explicit PerfectHashSet(const std::vector<std::string> &keys) : salt(0) {
+        build(keys);
+    }
+
+    // Replaces the contents; duplicate keys are stored once
+    void build(const std::vector<std::string> &keys) {
+        std::vector<std::string> uniqueKeys(keys);
+        std::sort(uniqueKeys.begin(), uniqueKeys.end());
+        uniqueKeys.erase(std::unique(uniqueKeys.begin(), uniqueKeys.end()), uniqueKeys.end());
+
+        text.clear();
+        keyOffsets.assign(1, 0);
+        size_t total = 0;
+        for (const std::string &key : uniqueKeys)
+            total += key.size();
+        text.reserve(total);
+        for (const std::string &key : uniqueKeys) {
+            text.add(key.data(), key.size());
+            keyOffsets.push_back(keyOffsets.back() + key.size());
+        }
+
+        std::vector<uint64_t> hashes(uniqueKeys.size());
+        for (salt = 0;; salt = mix(salt + 1)) {
+            for (size_t k = 0; k < uniqueKeys.size(); k++)
+                hashes[k] = hashOf(uniqueKeys[k].data(), uniqueKeys[k].size());
+            if (place(hashes))
+                break;
+        }
+    }
+
+    size_t size() const {
+        return keyOffsets.size() - 1;
+    }
+
+    bool contains(const std::string &key) const {
+        if (size() == 0)
+            return false;
+        uint64_t hash = hashOf(key.data(), key.size());
+        uint32_t k = slots[slotOf(hash, seeds[bucketOf(hash)])];
+        return k != EMPTY_SLOT && keyAt(k, key.data(), key.size());
+    }
+
+    size_t memoryBytes() const {
+        return text.memoryBytes() + keyOffsets.capacity() * sizeof(uint32_t) + seeds.capacity() * sizeof(uint32_t) +
+               slots.capacity() * sizeof(uint32_t);
+    }
+};
+
+// Heap bytes currently allocated by this process, for the micro-benchmarks. RSS is
+// not used because freed memory stays resident and would blur back-to-back runs.
+inline size_t heapBytesInUse() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+#endif
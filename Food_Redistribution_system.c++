@@ -5,6 +5,10 @@
 #include <set>
 #include <fstream>
 #include <sstream>
+#include <chrono>
+#include <iomanip>
+#include "Write_ahead_log.h"
+#include "Search_index.h"
 using namespace std;
 
 // Utility Function for Printing Separator Lines
@@ -61,8 +65,25 @@ unordered_map<int, vector<int>> matches; // Maps donation IDs to recipient IDs
 set<int> donationIds;  // To ensure donation IDs are unique
 set<int> recipientIds; // To ensure recipient IDs are unique
 
+// Full-text index over donations; document i is donations[i]
+enum DonationField { FOOD_TYPE_FIELD, LOCATION_FIELD, DONATION_FIELD_COUNT };
+SearchIndex donationIndex(DONATION_FIELD_COUNT);
+
+void indexDonation(const Donation &donation) {
+    donationIndex.add({donation.foodType, donation.location});
+}
+
 // Function Declarations
-void saveDonationsToFile(); // Declare saveDonationsToFile function
+void saveDonationsToFile(WalStore::SnapshotWriter &out);
+
+// Every donation is appended to donations.wal as it is added
+WalStore donationStore("donations", saveDonationsToFile);
+
+string encodeDonation(const Donation &donation) {
+    return RecordWriter().putInt(donation.id).putString(donation.foodType).putInt(donation.quantity)
+        .putString(donation.location).putString(donation.expirationDate).putString(donation.notes)
+        .putInt(donation.isRequested).str();
+}
 
 // Add Donation Function
 void addDonation() {
@@ -91,6 +112,8 @@ void addDonation() {
 
     donations.push_back(Donation(id, foodType, quantity, location, expirationDate, notes));
     donationIds.insert(id);
+    indexDonation(donations.back());
+    donationStore.put(walKey(id), encodeDonation(donations.back()));
     cout << "Donation added successfully!" << endl;
 }
 
@@ -143,15 +166,12 @@ void searchDonationsByLocation() {
     cin.ignore();
     getline(cin, location);
 
-    bool found = false;
-    for (const auto &donation : donations) {
-        if (donation.location.find(location) != string::npos) {
-            donation.display();
-            found = true;
-        }
+    vector<int> found = donationIndex.findSubstring(location, 1u << LOCATION_FIELD);
+    for (int doc : found) {
+        donations[doc].display();
     }
 
-    if (!found) {
+    if (found.empty()) {
         cout << "No donations found for the specified location!" << endl;
     }
 }
@@ -163,53 +183,35 @@ void searchDonationsByKeyword() {
     cin.ignore();
     getline(cin, keyword);
 
-    bool found = false;
-    for (const auto &donation : donations) {
-        if (donation.foodType.find(keyword) != string::npos || donation.location.find(keyword) != string::npos) {
-            donation.display();
-            found = true;
-        }
+    vector<int> found = donationIndex.findSubstring(keyword);
+    for (int doc : found) {
+        donations[doc].display();
     }
 
-    if (!found) {
+    if (found.empty()) {
         cout << "No donations found for the specified keyword!" << endl;
     }
 }
 
 // Logout Function
 void logout() {
-    cout << "Saving resources before exiting..." << endl;
-    saveDonationsToFile();
     cout << "Thank you for using the platform! Goodbye!" << endl;
 }
 
-// Save Donations to File
-void saveDonationsToFile() {
-    ofstream outFile("donations.txt");
-    if (!outFile) {
-        cout << "Error opening file!" << endl;
-        return;
-    }
-
+// Save Donations to a snapshot
+void saveDonationsToFile(WalStore::SnapshotWriter &out) {
     for (const auto &donation : donations) {
-        outFile << donation.id << "," << donation.foodType << "," << donation.quantity << ","
-                << donation.location << "," << donation.expirationDate << "," << donation.notes << endl;
+        out.put(walKey(donation.id), encodeDonation(donation));
     }
-
-    cout << "Donations saved to file!" << endl;
-    outFile.close();
 }
 
-// Load Donations from File
-void loadDonationsFromFile() {
+// One-time migration from the old comma-separated donations.txt
+bool importDonationsFromTextFile() {
     ifstream inFile("donations.txt");
     if (!inFile) {
-        cout << "Error opening file!" << endl;
-        return;
+        return false;
     }
 
-    donations.clear();
-    donationIds.clear();
     string line;
     while (getline(inFile, line)) {
         stringstream ss(line);
@@ -225,9 +227,42 @@ void loadDonationsFromFile() {
         donations.push_back(Donation(donationId, foodType, stoi(quantity), location, expirationDate, notes));
         donationIds.insert(donationId);
     }
+    inFile.close();
+    return true;
+}
+
+// Load Donations from the snapshot and log
+void loadDonationsFromFile() {
+    donations.clear();
+    donationIds.clear();
+    donationIndex = SearchIndex(DONATION_FIELD_COUNT);
+
+    vector<pair<string, string>> records;
+    if (!donationStore.open(records)) {
+        if (!importDonationsFromTextFile()) {
+            cout << "Error opening file!" << endl;
+            return;
+        }
+        donationStore.compact();
+    }
+
+    for (const auto &record : records) {
+        RecordReader in(record.second);
+        int id = in.getInt();
+        string foodType = in.getString();
+        int quantity = in.getInt();
+        string location = in.getString();
+        string expirationDate = in.getString();
+        string notes = in.getString();
+        donations.push_back(Donation(id, foodType, quantity, location, expirationDate, notes));
+        donations.back().isRequested = in.getInt();
+        donationIds.insert(id);
+    }
 
+    for (const auto &donation : donations) {
+        indexDonation(donation);
+    }
     cout << "Donations loaded from file!" << endl;
-    inFile.close();
 }
 
 // Main Menu
@@ -267,8 +302,68 @@ void menu() {
     } while (choice != 6);
 }
 
+// --bench-search: indexed keyword search vs the old linear string::find scan
+void runSearchBenchmark() {
+    typedef chrono::steady_clock Clock;
+    auto secondsSince = [](Clock::time_point start) {
+        return chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    const char *foods[] = {"Rice", "Bread", "Vegetables", "Fruit Basket", "Cooked Meals", "Milk", "Lentils", "Pasta"};
+    const char *areas[] = {"Kothrud", "Baner", "Hadapsar", "Wakad", "Aundh", "Viman Nagar", "Shivajinagar", "Hinjewadi"};
+    const int donationCount = 1000000;
+    const int queryCount = 50;
+
+    donations.clear();
+    srand(11);
+    for (int i = 0; i < donationCount; i++) {
+        donations.push_back(Donation(i, foods[rand() % 8], 1 + rand() % 50,
+                                     string(areas[rand() % 8]) + " Sector " + to_string(rand() % 500), "2025-01-01", ""));
+    }
+
+    Clock::time_point start = Clock::now();
+    donationIndex = SearchIndex(DONATION_FIELD_COUNT);
+    for (const auto &donation : donations) {
+        indexDonation(donation);
+    }
+    double buildSeconds = secondsSince(start);
+
+    vector<string> queries;
+    for (int q = 0; q < queryCount; q++) {
+        queries.push_back("Sector " + to_string(rand() % 500));
+    }
+
+    size_t scanHits = 0, indexHits = 0;
+    start = Clock::now();
+    for (const string &query : queries) {
+        for (const auto &donation : donations) {
+            if (donation.foodType.find(query) != string::npos || donation.location.find(query) != string::npos)
+                scanHits++;
+        }
+    }
+    double scanSeconds = secondsSince(start);
+
+    start = Clock::now();
+    for (const string &query : queries) {
+        indexHits += donationIndex.findSubstring(query).size();
+    }
+    double indexSeconds = secondsSince(start);
+
+    cout << fixed << setprecision(3);
+    cout << "Donation search benchmark (" << donationCount << " donations, " << queryCount << " keyword queries)\n";
+    cout << "  index build:  " << buildSeconds << " s\n";
+    cout << "  linear scan:  " << scanSeconds * 1000 / queryCount << " ms/query\n";
+    cout << "  search index: " << indexSeconds * 1000 / queryCount << " ms/query\n";
+    cout << "  hits scan/index: " << scanHits << "/" << indexHits << "\n";
+}
+
 // Main Function
-int main() {
+int main(int argc, char *argv[]) {
+    if (argc > 1 && string(argv[1]) == "--bench-search") {
+        runSearchBenchmark();
+        return 0;
+    }
+
     cout << "Welcome to the Food Waste Redistribution Platform!\n";
     cout << "Initializing system resources...\n";
 
@@ -7,6 +7,14 @@
 #include <fstream>
 #include <ctime>
 #include <algorithm>
+#include <chrono>
+#include <climits>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include "Write_ahead_log.h"
 
 using namespace std;
 
@@ -75,15 +83,103 @@ public:
     }
 };
 
-void logAction(const string &action) {
-    ofstream logFile("hazardous_waste_log.txt", ios::app);
-    if (logFile.is_open()) {
-        time_t now = time(nullptr);
-        logFile << ctime(&now) << " - " << action << "\n";
-        logFile.close();
-    } else {
-        cerr << "Unable to open log file.\n";
+// Action log written by a background thread. Callers only append to an in-memory
+// batch; the thread wakes every flushInterval (or when a batch fills up), formats
+// the timestamps and writes the whole batch with one stream write.
+class AsyncLogger {
+private:
+    struct Entry {
+        time_t when;
+        string action;
+    };
+
+    string fileName;
+    chrono::milliseconds flushInterval;
+    size_t batchSize;
+    mutex lock;
+    condition_variable wake;
+    vector<Entry> pending;
+    bool stopping;
+    thread flusher;
+
+    void writeBatch(vector<Entry> &batch) {
+        if (batch.empty())
+            return;
+        string text;
+        char stamp[32];
+        time_t formattedAt = -1;
+        for (const Entry &entry : batch) {
+            if (entry.when != formattedAt) {
+                struct tm local;
+#ifdef _WIN32
+                localtime_s(&local, &entry.when);
+#else
+                localtime_r(&entry.when, &local);
+#endif
+                strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &local);
+                formattedAt = entry.when;
+            }
+            text += stamp;
+            text += " - ";
+            text += entry.action;
+            text += '\n';
+        }
+        ofstream logFile(fileName, ios::app);
+        if (logFile.is_open()) {
+            logFile << text;
+        } else {
+            cerr << "Unable to open log file.\n";
+        }
+        batch.clear();
+    }
+
+    void run() {
+        vector<Entry> batch;
+        unique_lock<mutex> guard(lock);
+        while (true) {
+            wake.wait_for(guard, flushInterval, [this]() { return stopping || pending.size() >= batchSize; });
+            batch.swap(pending);
+            bool done = stopping;
+            guard.unlock();
+            writeBatch(batch);
+            guard.lock();
+            if (done && pending.empty())
+                return;
+        }
     }
+
+public:
+    explicit AsyncLogger(const string &fileName, chrono::milliseconds flushInterval = chrono::milliseconds(200),
+                         size_t batchSize = 1024)
+        : fileName(fileName), flushInterval(flushInterval), batchSize(batchSize), stopping(false) {
+        flusher = thread(&AsyncLogger::run, this);
+    }
+
+    ~AsyncLogger() {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+        }
+        wake.notify_one();
+        flusher.join();
+    }
+
+    void log(const string &action) {
+        bool full;
+        {
+            lock_guard<mutex> guard(lock);
+            pending.push_back({time(nullptr), action});
+            full = pending.size() >= batchSize;
+        }
+        if (full)
+            wake.notify_one();
+    }
+};
+
+AsyncLogger actionLog("hazardous_waste_log.txt");
+
+long long wallClockMs() {
+    return chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
 }
 
 struct HazardousItem {
@@ -91,14 +187,182 @@ struct HazardousItem {
     string category;
     string disposalMethod;
     int riskLevel;
+    long long sequence;    // intake order, also the item's log key
+    long long enqueuedAtMs; // wall clock, drives risk aging
 
-    HazardousItem(string n, string c, string d, int r)
-        : name(n), category(c), disposalMethod(d), riskLevel(r) {}
+    HazardousItem(string n, string c, string d, int r, long long s = 0, long long t = 0)
+        : name(n), category(c), disposalMethod(d), riskLevel(r), sequence(s), enqueuedAtMs(t) {}
 };
 
-struct CompareRisk {
-    bool operator()(const HazardousItem &a, const HazardousItem &b) {
-        return a.riskLevel < b.riskLevel;
+// Thread-safe disposal queue shared by intake desks (producers) and disposal crews
+// (consumers). Items are spread over independently locked shards, each a binary
+// heap, so producers and crews rarely meet on the same lock.
+//
+// Risk aging: an item's effective risk grows by one level per agingStepMs it has
+// waited. Every item ages at the same rate, so comparing effective risk at any
+// moment is the same as comparing riskLevel * agingStepMs - enqueuedAtMs. That
+// key never changes, so heaps stay valid and old low-risk items still overtake
+// fresh high-risk ones in the end.
+class DisposalScheduler {
+private:
+    struct Shard {
+        mutex lock;
+        vector<HazardousItem> heap;
+        atomic<long long> topKey; // key of heap.front(), EMPTY_KEY when empty
+    };
+
+    static const long long EMPTY_KEY = LLONG_MIN;
+
+    long long agingStepMs;
+    vector<unique_ptr<Shard>> shards;
+    atomic<unsigned> nextShard;
+    atomic<long long> pendingCount;
+    atomic<int> waitingCrews; // producers skip the wakeup entirely while this is 0
+    mutex idleLock;
+    condition_variable idle;
+    bool closed;
+
+    long long keyOf(const HazardousItem &item) const {
+        return item.riskLevel * agingStepMs - item.enqueuedAtMs;
+    }
+
+    bool lowerPriority(const HazardousItem &a, const HazardousItem &b) const {
+        long long keyA = keyOf(a), keyB = keyOf(b);
+        return keyA != keyB ? keyA < keyB : a.sequence > b.sequence;
+    }
+
+    void publishTop(Shard &shard) {
+        shard.topKey.store(shard.heap.empty() ? EMPTY_KEY : keyOf(shard.heap.front()), memory_order_release);
+    }
+
+    // Lost a race with another crew: yield the core for the first few retries,
+    // then sleep for 1, 2, 4 ... 64 microseconds so the winner can finish
+    static void backoff(unsigned &retries) {
+        if (retries < 4)
+            this_thread::yield();
+        else
+            this_thread::sleep_for(chrono::microseconds(1u << min(retries - 4, 6u)));
+        retries++;
+    }
+
+public:
+    explicit DisposalScheduler(long long agingStepMs = 10 * 60 * 1000, unsigned shardCount = 0)
+        : agingStepMs(agingStepMs), nextShard(0), pendingCount(0), waitingCrews(0), closed(false) {
+        if (shardCount == 0)
+            shardCount = max(4u, 2 * thread::hardware_concurrency());
+        for (unsigned i = 0; i < shardCount; i++) {
+            shards.emplace_back(new Shard());
+            shards.back()->topKey = EMPTY_KEY;
+        }
+    }
+
+    void submit(const HazardousItem &item) {
+        Shard &shard = *shards[nextShard.fetch_add(1, memory_order_relaxed) % shards.size()];
+        {
+            lock_guard<mutex> guard(shard.lock);
+            shard.heap.push_back(item);
+            push_heap(shard.heap.begin(), shard.heap.end(),
+                      [this](const HazardousItem &a, const HazardousItem &b) { return lowerPriority(a, b); });
+            publishTop(shard);
+        }
+        // Sequentially consistent pair with dispatch(): either the crew sees the new
+        // count before sleeping, or we see the crew and wake it
+        pendingCount.fetch_add(1);
+        if (waitingCrews.load() > 0) {
+            {
+                lock_guard<mutex> guard(idleLock);
+            }
+            idle.notify_one();
+        }
+    }
+
+    // Takes the most urgent item without waiting. Shard tops are read lock-free and
+    // only the best shard is locked, so under contention the choice is very nearly,
+    // but not strictly, the global maximum.
+    bool tryDispatch(HazardousItem &out) {
+        unsigned retries = 0;
+        while (pendingCount.load(memory_order_acquire) > 0) {
+            Shard *best = nullptr;
+            long long bestKey = EMPTY_KEY;
+            for (auto &shard : shards) {
+                long long key = shard->topKey.load(memory_order_acquire);
+                if (key != EMPTY_KEY && (best == nullptr || key > bestKey)) {
+                    best = shard.get();
+                    bestKey = key;
+                }
+            }
+            if (best == nullptr) {
+                backoff(retries); // another crew took the last item and has not updated the count yet
+                continue;
+            }
+
+            unique_lock<mutex> guard(best->lock);
+            if (best->heap.empty()) {
+                guard.unlock();
+                backoff(retries); // another crew emptied it first
+                continue;
+            }
+            pop_heap(best->heap.begin(), best->heap.end(),
+                     [this](const HazardousItem &a, const HazardousItem &b) { return lowerPriority(a, b); });
+            out = move(best->heap.back());
+            best->heap.pop_back();
+            publishTop(*best);
+            pendingCount.fetch_sub(1, memory_order_acq_rel);
+            return true;
+        }
+        return false;
+    }
+
+    // Blocks until an item is available; false once close() was called and the
+    // queue has drained.
+    bool dispatch(HazardousItem &out) {
+        while (true) {
+            if (tryDispatch(out))
+                return true;
+            unique_lock<mutex> guard(idleLock);
+            waitingCrews.fetch_add(1);
+            idle.wait(guard, [this]() { return closed || pendingCount.load() > 0; });
+            waitingCrews.fetch_sub(1);
+            if (closed && pendingCount.load() == 0)
+                return false;
+        }
+    }
+
+    // Wakes every waiting crew; dispatch() returns false once the queue is empty
+    void close() {
+        {
+            lock_guard<mutex> guard(idleLock);
+            closed = true;
+        }
+        idle.notify_all();
+    }
+
+    long long size() const {
+        return pendingCount.load(memory_order_acquire);
+    }
+
+    // Copy of the queue, most urgent first, without removing anything. Shards are
+    // copied one at a time, so the view is consistent per shard, not globally.
+    vector<HazardousItem> snapshot(size_t limit = SIZE_MAX) {
+        vector<HazardousItem> items;
+        for (auto &shard : shards) {
+            lock_guard<mutex> guard(shard->lock);
+            items.insert(items.end(), shard->heap.begin(), shard->heap.end());
+        }
+        auto moreUrgent = [this](const HazardousItem &a, const HazardousItem &b) { return lowerPriority(b, a); };
+        if (limit < items.size()) {
+            partial_sort(items.begin(), items.begin() + limit, items.end(), moreUrgent);
+            items.erase(items.begin() + limit, items.end());
+        } else {
+            sort(items.begin(), items.end(), moreUrgent);
+        }
+        return items;
+    }
+
+    // Risk level including aging, capped at 10
+    int effectiveRisk(const HazardousItem &item, long long nowMs) const {
+        long long aged = item.riskLevel + max(0LL, nowMs - item.enqueuedAtMs) / agingStepMs;
+        return (int)min(10LL, aged);
     }
 };
 
@@ -106,21 +370,62 @@ class AdminFunctions {
 private:
     unordered_map<string, string> disposalMethods;
     unordered_map<string, int> itemInventory;
-    priority_queue<HazardousItem, vector<HazardousItem>, CompareRisk> disposalQueue;
+    DisposalScheduler disposalQueue;
+    mutex storeLock; // crews dispatch concurrently; the log itself is single-writer
+    WalStore store;  // keys: "method:<item>", "stock:<item>", "queue:<sequence>"
+    long long nextQueueKey;
+    AsyncLogger &auditLog;
+
+    static string encodeItem(const HazardousItem &item) {
+        return RecordWriter().putString(item.name).putString(item.category).putString(item.disposalMethod)
+            .putInt(item.riskLevel).putInt(item.enqueuedAtMs).str();
+    }
+
+    void saveStateToFile(WalStore::SnapshotWriter &out) {
+        for (const auto &pair : disposalMethods) {
+            out.put("method:" + pair.first, RecordWriter().putString(pair.second).str());
+        }
+        for (const auto &pair : itemInventory) {
+            out.put("stock:" + pair.first, RecordWriter().putInt(pair.second).str());
+        }
+        for (const HazardousItem &item : disposalQueue.snapshot()) {
+            out.put("queue:" + walKey(item.sequence), encodeItem(item));
+        }
+    }
+
+    void loadStateFromFile() {
+        vector<pair<string, string>> records;
+        if (!store.open(records)) {
+            importDisposalMethodsFromTextFile();
+            importInventoryFromTextFile();
+            importDisposalQueueFromTextFile();
+            store.compact();
+            return;
+        }
 
-    void saveDisposalMethodsToFile() {
-        ofstream outFile("disposal_methods.txt");
-        if (outFile.is_open()) {
-            for (const auto &pair : disposalMethods) {
-                outFile << pair.first << "," << pair.second << "\n";
+        for (const auto &record : records) {
+            const string &key = record.first;
+            RecordReader in(record.second);
+            if (key.compare(0, 7, "method:") == 0) {
+                disposalMethods[key.substr(7)] = in.getString();
+            } else if (key.compare(0, 6, "stock:") == 0) {
+                itemInventory[key.substr(6)] = in.getInt();
+            } else if (key.compare(0, 6, "queue:") == 0) {
+                string name = in.getString();
+                string category = in.getString();
+                string method = in.getString();
+                int riskLevel = in.getInt();
+                long long enqueuedAtMs = in.getInt(); // 0 in records written before aging
+                long long sequence = stoll(key.substr(6));
+                disposalQueue.submit(HazardousItem(name, category, method, riskLevel, sequence,
+                                                   enqueuedAtMs ? enqueuedAtMs : wallClockMs()));
+                nextQueueKey = max(nextQueueKey, sequence + 1);
             }
-            outFile.close();
-        } else {
-            cerr << "Unable to open file for saving disposal methods.\n";
         }
     }
 
-    void loadDisposalMethodsFromFile() {
+    // One-time migration from the old comma-separated text files
+    void importDisposalMethodsFromTextFile() {
         ifstream inFile("disposal_methods.txt");
         if (inFile.is_open()) {
             string line;
@@ -136,19 +441,7 @@ private:
         }
     }
 
-    void saveInventoryToFile() {
-        ofstream outFile("inventory.txt");
-        if (outFile.is_open()) {
-            for (const auto &pair : itemInventory) {
-                outFile << pair.first << "," << pair.second << "\n";
-            }
-            outFile.close();
-        } else {
-            cerr << "Unable to open file for saving inventory.\n";
-        }
-    }
-
-    void loadInventoryFromFile() {
+    void importInventoryFromTextFile() {
         ifstream inFile("inventory.txt");
         if (inFile.is_open()) {
             string line;
@@ -164,22 +457,7 @@ private:
         }
     }
 
-    void saveDisposalQueueToFile() {
-        ofstream outFile("disposal_queue.txt");
-        if (outFile.is_open()) {
-            auto tempQueue = disposalQueue;
-            while (!tempQueue.empty()) {
-                HazardousItem item = tempQueue.top();
-                tempQueue.pop();
-                outFile << item.name << "," << item.category << "," << item.disposalMethod << "," << item.riskLevel << "\n";
-            }
-            outFile.close();
-        } else {
-            cerr << "Unable to open file for saving disposal queue.\n";
-        }
-    }
-
-    void loadDisposalQueueFromFile() {
+    void importDisposalQueueFromTextFile() {
         ifstream inFile("disposal_queue.txt");
         if (inFile.is_open()) {
             string line;
@@ -191,7 +469,7 @@ private:
                 string category = line.substr(pos1 + 1, pos2 - pos1 - 1);
                 string method = line.substr(pos2 + 1, pos3 - pos2 - 1);
                 int riskLevel = stoi(line.substr(pos3 + 1));
-                disposalQueue.emplace(name, category, method, riskLevel);
+                disposalQueue.submit(HazardousItem(name, category, method, riskLevel, nextQueueKey++, wallClockMs()));
             }
             inFile.close();
         } else {
@@ -200,16 +478,10 @@ private:
     }
 
 public:
-    AdminFunctions() {
-        loadDisposalMethodsFromFile();
-        loadInventoryFromFile();
-        loadDisposalQueueFromFile();
-    }
-
-    ~AdminFunctions() {
-        saveDisposalMethodsToFile();
-        saveInventoryToFile();
-        saveDisposalQueueToFile();
+    explicit AdminFunctions(const string &storeName = "hazardous", AsyncLogger &auditLog = actionLog)
+        : store(storeName, [this](WalStore::SnapshotWriter &out) { saveStateToFile(out); }), nextQueueKey(0),
+          auditLog(auditLog) {
+        loadStateFromFile();
     }
 
     void displayWasteCategories() {
@@ -254,14 +526,16 @@ public:
 
     void addDisposalMethod(const string &item, const string &method) {
         disposalMethods[item] = method;
+        store.put("method:" + item, RecordWriter().putString(method).str());
         cout << "Admin: Added disposal method for " << item << " -> " << method << "\n";
-        logAction("Added disposal method for " + item + " -> " + method);
+        auditLog.log("Added disposal method for " + item + " -> " + method);
     }
 
     void updateInventory(const string &item, int count) {
         itemInventory[item] += count;
+        store.put("stock:" + item, RecordWriter().putInt(itemInventory[item]).str());
         cout << "Admin: Updated inventory for " << item << " by " << count << " units. Total: " << itemInventory[item] << "\n";
-        logAction("Updated inventory for " + item + " by " + to_string(count) + " units");
+        auditLog.log("Updated inventory for " + item + " by " + to_string(count) + " units");
     }
 
     void displayDisposalMethods() {
@@ -278,9 +552,26 @@ public:
         }
     }
 
+    // Queues an item for disposal; safe to call from several intake threads
+    HazardousItem submitItem(const string &name, const string &category, int riskLevel) {
+        auto method = disposalMethods.find(name);
+        HazardousItem item(name, category, method == disposalMethods.end() ? "" : method->second, riskLevel);
+        {
+            // Memory first, then the log. A crew that takes the item straight away
+            // blocks on storeLock, so its erase is always logged after this put
+            lock_guard<mutex> guard(storeLock);
+            item.sequence = nextQueueKey++;
+            item.enqueuedAtMs = wallClockMs();
+            disposalQueue.submit(item);
+            store.put("queue:" + walKey(item.sequence), encodeItem(item));
+        }
+        auditLog.log("Enqueued hazardous item: " + name + " with risk level: " + to_string(riskLevel));
+        return item;
+    }
+
     void enqueueHazardousItem(const string &name, const string &category, int riskLevel) {
-        string disposalMethod = disposalMethods[name];
-        if (disposalMethod.empty()) {
+        auto method = disposalMethods.find(name);
+        if (method == disposalMethods.end() || method->second.empty()) {
             auto recommendedMethods = getRecommendedDisposalMethods(category);
             if (!recommendedMethods.empty()) {
                 cout << "\nRecommended disposal methods for " << category << ":\n";
@@ -289,22 +580,40 @@ public:
                 }
             }
         }
-        disposalQueue.emplace(name, category, disposalMethod, riskLevel);
+        submitItem(name, category, riskLevel);
         cout << "Admin: Enqueued hazardous item: " << name << " with risk level: " << riskLevel << "\n";
-        logAction("Enqueued hazardous item: " + name + " with risk level: " + to_string(riskLevel));
+    }
+
+    // Hands the most urgent item to a crew; safe to call from several crew threads
+    bool dispatchNextItem(HazardousItem &item) {
+        if (!disposalQueue.tryDispatch(item))
+            return false;
+        {
+            lock_guard<mutex> guard(storeLock);
+            store.erase("queue:" + walKey(item.sequence));
+        }
+        auditLog.log("Dispatched hazardous item: " + item.name + " with risk level: " + to_string(item.riskLevel));
+        return true;
     }
 
     void viewDisposalQueue() {
         cout << "\nPending Disposal Queue:\n";
-        auto tempQueue = disposalQueue;
-        while (!tempQueue.empty()) {
-            HazardousItem item = tempQueue.top();
-            tempQueue.pop();
+        long long nowMs = wallClockMs();
+        for (const HazardousItem &item : disposalQueue.snapshot()) {
+            int effectiveRisk = disposalQueue.effectiveRisk(item, nowMs);
             cout << "Item: " << item.name
                  << " | Category: " << item.category
-                 << " | Risk Level: " << item.riskLevel << "\n";
+                 << " | Risk Level: " << item.riskLevel;
+            if (effectiveRisk > item.riskLevel) {
+                cout << " (aged to " << effectiveRisk << ")";
+            }
+            cout << "\n";
         }
     }
+
+    long long pendingItems() const {
+        return disposalQueue.size();
+    }
 };
 
 void adminMenu(AdminFunctions &admin) {
@@ -317,8 +626,9 @@ void adminMenu(AdminFunctions &admin) {
         cout << "4. Display Inventory\n";
         cout << "5. Enqueue Hazardous Item\n";
         cout << "6. View Disposal Queue\n";
-        cout << "7. View Waste Categories\n";
-        cout << "8. Logout\n";
+        cout << "7. Dispatch Next Item to Crew\n";
+        cout << "8. View Waste Categories\n";
+        cout << "9. Logout\n";
         cout << "Enter your choice: ";
         cin >> choice;
 
@@ -402,16 +712,26 @@ void adminMenu(AdminFunctions &admin) {
         case 6:
             admin.viewDisposalQueue();
             break;
-        case 7:
-            admin.displayWasteCategories();
+        case 7: {
+            HazardousItem item("", "", "", 0);
+            if (admin.dispatchNextItem(item)) {
+                cout << "Dispatched: " << item.name << " | Category: " << item.category
+                     << " | Risk Level: " << item.riskLevel << " | Method: " << item.disposalMethod << "\n";
+            } else {
+                cout << "Disposal queue is empty.\n";
+            }
             break;
+        }
         case 8:
+            admin.displayWasteCategories();
+            break;
+        case 9:
             cout << "Logging out...\n";
             break;
         default:
             cout << "Invalid choice. Try again.\n";
         }
-    } while (choice != 8);
+    } while (choice != 9);
 }
 
 void userMenu(AdminFunctions &admin) {
@@ -448,7 +768,250 @@ void userMenu(AdminFunctions &admin) {
     } while (choice != 5);
 }
 
-int main() {
+// Single lock around a std::priority_queue, the shape of the old disposal queue.
+// Only used as the baseline in the stress test.
+class LockedDisposalQueue {
+private:
+    struct Later {
+        long long agingStepMs;
+        bool operator()(const HazardousItem &a, const HazardousItem &b) const {
+            long long keyA = a.riskLevel * agingStepMs - a.enqueuedAtMs, keyB = b.riskLevel * agingStepMs - b.enqueuedAtMs;
+            return keyA != keyB ? keyA < keyB : a.sequence > b.sequence;
+        }
+    };
+
+    mutex lock;
+    condition_variable ready;
+    priority_queue<HazardousItem, vector<HazardousItem>, Later> queue;
+    bool closed;
+
+public:
+    explicit LockedDisposalQueue(long long agingStepMs) : queue(Later{agingStepMs}), closed(false) {}
+
+    void submit(const HazardousItem &item) {
+        {
+            lock_guard<mutex> guard(lock);
+            queue.push(item);
+        }
+        ready.notify_one();
+    }
+
+    bool dispatch(HazardousItem &out) {
+        unique_lock<mutex> guard(lock);
+        ready.wait(guard, [this]() { return closed || !queue.empty(); });
+        if (queue.empty())
+            return false;
+        out = queue.top();
+        queue.pop();
+        return true;
+    }
+
+    void close() {
+        {
+            lock_guard<mutex> guard(lock);
+            closed = true;
+        }
+        ready.notify_all();
+    }
+
+    bool tryDispatch(HazardousItem &out) {
+        lock_guard<mutex> guard(lock);
+        if (queue.empty())
+            return false;
+        out = queue.top();
+        queue.pop();
+        return true;
+    }
+
+    vector<HazardousItem> snapshot(size_t limit) {
+        lock_guard<mutex> guard(lock);
+        auto copy = queue;
+        vector<HazardousItem> items;
+        while (!copy.empty() && items.size() < limit) {
+            items.push_back(copy.top());
+            copy.pop();
+        }
+        return items;
+    }
+};
+
+typedef chrono::steady_clock StressClock;
+
+static void reportStress(const string &label, int threadCount, int itemCount, double seconds,
+                         const vector<vector<long long>> &latencies, long long snapshots, int wrong) {
+    vector<long long> all;
+    for (auto &mine : latencies)
+        all.insert(all.end(), mine.begin(), mine.end());
+    sort(all.begin(), all.end());
+    auto percentile = [&](double p) { return all.empty() ? 0 : all[min(all.size() - 1, (size_t)(p * all.size()))]; };
+
+    cout << "  " << left << setw(10) << label << right << setw(3) << threadCount << " threads: " << setw(10)
+         << (long long)(itemCount / seconds) << " dequeues/s  p50 " << setw(6) << percentile(0.5) << " ns  p99 "
+         << setw(7) << percentile(0.99) << " ns  p99.9 " << setw(8) << percentile(0.999) << " ns"
+         << (snapshots ? "  snapshots " + to_string(snapshots) : "") << (wrong ? "  LOST/DUPLICATED: " + to_string(wrong) : "") << "\n";
+}
+
+// Intake desks and crews hammer one queue at the same time; each dispatch is also
+// logged. Crews block in dispatch() and leave once the desks are done and the
+// queue is closed. Reports dequeues/sec and per-dispatch latency percentiles, and
+// checks that every item came out exactly once.
+template <typename Queue>
+void stressDisposalQueue(Queue &queue, const string &label, int threadCount, int itemCount, AsyncLogger &log) {
+    int producers = threadCount / 2, crews = threadCount - producers;
+
+    vector<atomic<int>> dispatched(itemCount);
+    for (auto &count : dispatched)
+        count = 0;
+    vector<vector<long long>> latencies(crews);
+    atomic<bool> drained(false);
+    atomic<long long> snapshots(0);
+
+    StressClock::time_point start = StressClock::now();
+    vector<thread> desks, crewThreads;
+    for (int p = 0; p < producers; p++) {
+        desks.emplace_back([&, p]() {
+            unsigned seed = 7919 * (p + 1);
+            for (int i = p; i < itemCount; i += producers) {
+                seed = seed * 1103515245 + 12345;
+                queue.submit(HazardousItem("item" + to_string(i), "Chemical", "Neutralization", 1 + (seed >> 16) % 10, i,
+                                           wallClockMs()));
+            }
+        });
+    }
+    for (int c = 0; c < crews; c++) {
+        crewThreads.emplace_back([&, c]() {
+            vector<long long> &mine = latencies[c];
+            mine.reserve(itemCount / crews + 1024);
+            HazardousItem item("", "", "", 0);
+            while (true) {
+                StressClock::time_point begin = StressClock::now();
+                if (!queue.dispatch(item))
+                    break;
+                mine.push_back(chrono::duration_cast<chrono::nanoseconds>(StressClock::now() - begin).count());
+                dispatched[item.sequence]++;
+                log.log("Dispatched hazardous item: " + item.name);
+            }
+        });
+    }
+    thread viewer([&]() {
+        while (!drained.load()) {
+            queue.snapshot(10);
+            snapshots++;
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+    });
+    for (thread &desk : desks)
+        desk.join();
+    queue.close();
+    for (thread &crew : crewThreads)
+        crew.join();
+    drained = true;
+    viewer.join();
+    double seconds = chrono::duration<double>(StressClock::now() - start).count();
+
+    int wrong = 0;
+    for (auto &count : dispatched)
+        wrong += count.load() != 1;
+    reportStress(label, threadCount, itemCount, seconds, latencies, snapshots.load(), wrong);
+}
+
+static void removeStressStore(const string &storeName) {
+    for (const char *suffix : {".wal", ".snap", ".snap.tmp"})
+        remove((storeName + suffix).c_str());
+}
+
+// The same load through AdminFunctions: desks call submitItem and crews poll
+// dispatchNextItem, so every intake and dispatch is also written to the WAL.
+// Afterwards the store is reopened and must hold no queued items.
+void stressAdminDispatch(int threadCount, int itemCount, AsyncLogger &log) {
+    const string storeName = "hazardous_stress";
+    int producers = threadCount / 2, crews = threadCount - producers;
+
+    removeStressStore(storeName);
+    {
+        // An empty snapshot up front keeps AdminFunctions from importing the old text files
+        WalStore empty(storeName, [](WalStore::SnapshotWriter &) {});
+        empty.compact();
+    }
+
+    vector<atomic<int>> dispatched(itemCount);
+    for (auto &count : dispatched)
+        count = 0;
+    vector<vector<long long>> latencies(crews);
+    atomic<long long> remaining(itemCount);
+    double seconds;
+    {
+        AdminFunctions admin(storeName, log);
+        StressClock::time_point start = StressClock::now();
+        vector<thread> threads;
+        for (int p = 0; p < producers; p++) {
+            threads.emplace_back([&, p]() {
+                unsigned seed = 7919 * (p + 1);
+                for (int i = p; i < itemCount; i += producers) {
+                    seed = seed * 1103515245 + 12345;
+                    admin.submitItem("item" + to_string(i), "Chemical", 1 + (seed >> 16) % 10);
+                }
+            });
+        }
+        for (int c = 0; c < crews; c++) {
+            threads.emplace_back([&, c]() {
+                vector<long long> &mine = latencies[c];
+                mine.reserve(itemCount / crews + 1024);
+                HazardousItem item("", "", "", 0);
+                while (remaining.load() > 0) {
+                    StressClock::time_point begin = StressClock::now();
+                    if (!admin.dispatchNextItem(item)) {
+                        this_thread::yield();
+                        continue;
+                    }
+                    mine.push_back(chrono::duration_cast<chrono::nanoseconds>(StressClock::now() - begin).count());
+                    dispatched[stoi(item.name.substr(4))]++;
+                    remaining--;
+                }
+            });
+        }
+        for (thread &worker : threads)
+            worker.join();
+        seconds = chrono::duration<double>(StressClock::now() - start).count();
+    }
+
+    int wrong = 0;
+    for (auto &count : dispatched)
+        wrong += count.load() != 1;
+    reportStress("admin+WAL", threadCount, itemCount, seconds, latencies, 0, wrong);
+
+    AdminFunctions reopened(storeName, log);
+    if (reopened.pendingItems() != 0)
+        cout << "  WAL still holds " << reopened.pendingItems() << " dispatched items after reopening\n";
+    removeStressStore(storeName);
+}
+
+void runDispatchStressTest() {
+    const int itemCount = 200000;
+    const long long agingStepMs = 50; // short, so aging reorders items during the run
+    string logFile = "hazardous_stress_log.tmp";
+
+    cout << "Disposal queue stress test (" << itemCount << " items, half intake / half crew threads, "
+         << thread::hardware_concurrency() << " cores)\n";
+    {
+        AsyncLogger log(logFile);
+        for (int threadCount : {8, 16, 32}) {
+            LockedDisposalQueue locked(agingStepMs);
+            stressDisposalQueue(locked, "one lock", threadCount, itemCount, log);
+            DisposalScheduler sharded(agingStepMs);
+            stressDisposalQueue(sharded, "sharded", threadCount, itemCount, log);
+            stressAdminDispatch(threadCount, itemCount, log);
+        }
+    }
+    remove(logFile.c_str());
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && string(argv[1]) == "--stress") {
+        runDispatchStressTest();
+        return 0;
+    }
+
     LoginSystem loginSystem;
     AdminFunctions admin;
 
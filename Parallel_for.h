@@ -0,0 +1,34 @@
+// Parallel_for.h
+// Shared worker-pool helper for the batch paths of the modules (distance matrices,
+// route improvement, bulk forecasts and complaint classification). There is no
+// persistent pool: each call starts its threads and joins them before returning.
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Runs task(i) for every i in [0, count) on a fixed pool of worker threads
+template <typename Task>
+void parallelFor(int count, Task task, unsigned threadCount = 0) {
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min<unsigned>(threadCount, std::max(1, count));
+
+    std::atomic<int> next(0);
+    auto worker = [&]() {
+        for (int i = next++; i < count; i = next++)
+            task(i);
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threadCount; ++t)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread &t : pool)
+        t.join();
+}
+
+#endif
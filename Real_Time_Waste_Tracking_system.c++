@@ -3,8 +3,18 @@
 #include <limits.h>
 #include <vector>
 #include <algorithm>
-#include <stack>
 #include <fstream>
+#include <unordered_map>
+#include <deque>
+#include <memory>
+#include <random>
+#include <chrono>
+#include <iomanip>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include "Write_ahead_log.h"
+#include "Routing_engine.h"
 
 using namespace std;
 
@@ -15,14 +25,13 @@ struct Node {
     Node(int id, string name) : id(id), name(name) {}
 };
 
-// Edge structure for the graph
-struct Edge {
-    int from;
-    int to;
-    int weight;
-    Edge(int from, int to, int weight) : from(from), to(to), weight(weight) {}
-    Edge() : from(0), to(0), weight(0) {}
-};
+// Routes are stored in whole kilometres
+typedef WeightedEdge<int> Edge;
+typedef BasicShortestPathTree<int> ShortestPathTree;
+typedef BasicRoutingEngine<int> RoutingEngine;
+typedef BasicDistanceMatrix<int> DistanceMatrix;
+typedef BasicVehicleRoute<int> VehicleRoute;
+typedef BasicCollectionPlan<int> CollectionPlan;
 
 // Graph class with improved error handling
 class Graph {
@@ -30,26 +39,76 @@ private:
     vector<string> nodeNames;
     vector<vector<Edge>> adjList;
     int nodeCount;
+    mutable RoutingEngine router;
+
+    // Snapshot holds "graph" (node count, next op) and one "node:<i>" record per point;
+    // the log holds every mutation since as "op:<sequence>".
+    enum GraphOp { SET_NODE_COUNT = 1, ADD_NODE, ADD_EDGE, DELETE_NODE, MODIFY_NODE, DELETE_EDGE, MODIFY_EDGE };
+    WalStore store;
+    long long nextOp;
+    bool replaying;
+
+    void logOp(const RecordWriter &op) {
+        if (!replaying)
+            store.put("op:" + walKey(nextOp++), op.str());
+    }
 
-public:
-    Graph() : nodeCount(0) {
-        loadGraphFromFile();
+    void replayOp(RecordReader &in) {
+        switch (in.getInt()) {
+        case SET_NODE_COUNT:
+            setNodeCount(in.getInt());
+            break;
+        case ADD_NODE: {
+            int index = in.getInt();
+            addNode(index, in.getString());
+            break;
+        }
+        case ADD_EDGE: {
+            string fromName = in.getString(), toName = in.getString();
+            addEdge(fromName, toName, in.getInt());
+            break;
+        }
+        case DELETE_NODE:
+            deleteNode(in.getInt());
+            break;
+        case MODIFY_NODE: {
+            int index = in.getInt();
+            modifyNode(index, in.getString());
+            break;
+        }
+        case DELETE_EDGE: {
+            string fromName = in.getString(), toName = in.getString();
+            deleteEdge(fromName, toName);
+            break;
+        }
+        case MODIFY_EDGE: {
+            string fromName = in.getString(), toName = in.getString();
+            modifyEdge(fromName, toName, in.getInt());
+            break;
+        }
+        }
     }
 
-    ~Graph() {
-        saveGraphToFile();
+public:
+    Graph()
+        : nodeCount(0), store("graph", [this](WalStore::SnapshotWriter &out) { saveGraphToFile(out); }),
+          nextOp(0), replaying(false) {
+        loadGraphFromFile();
     }
 
     void setNodeCount(int count) {
         nodeCount = count;
         nodeNames.resize(count);
         adjList.resize(count);
+        router.clear();
+        logOp(RecordWriter().putInt(SET_NODE_COUNT).putInt(count));
     }
 
     bool addNode(int index, const string &name) {
         if (index < 0 || index >= nodeCount)
             return false;
         nodeNames[index] = name;
+        logOp(RecordWriter().putInt(ADD_NODE).putInt(index).putString(name));
         return true;
     }
 
@@ -63,6 +122,8 @@ public:
         // Add edge in both directions (undirected graph)
         adjList[from].push_back(Edge(from, to, weight));
         adjList[to].push_back(Edge(to, from, weight));
+        router.edgeAdded(from, to, weight);
+        logOp(RecordWriter().putInt(ADD_EDGE).putString(fromName).putString(toName).putInt(weight));
         return true;
     }
 
@@ -93,6 +154,8 @@ public:
         }
 
         nodeCount--;
+        router.nodeDeleted(nodeIndex);
+        logOp(RecordWriter().putInt(DELETE_NODE).putInt(nodeIndex));
         return true;
     }
 
@@ -100,6 +163,7 @@ public:
         if (nodeIndex < 0 || nodeIndex >= nodeCount)
             return false;
         nodeNames[nodeIndex] = newName;
+        logOp(RecordWriter().putInt(MODIFY_NODE).putInt(nodeIndex).putString(newName));
         return true;
     }
 
@@ -122,6 +186,8 @@ public:
 
         removeEdge(adjList[from], from, to);
         removeEdge(adjList[to], to, from);
+        router.edgeDeleted(from, to);
+        logOp(RecordWriter().putInt(DELETE_EDGE).putString(fromName).putString(toName));
         return true;
     }
 
@@ -136,9 +202,11 @@ public:
             return false;
 
         // Modify edge in both directions
-        auto modifyEdgeWeight = [newWeight](vector<Edge> &edges, int from, int to) {
+        int oldWeight = -1;
+        auto modifyEdgeWeight = [newWeight, &oldWeight](vector<Edge> &edges, int from, int to) {
             for (Edge &e : edges) {
                 if (e.from == from && e.to == to) {
+                    oldWeight = e.weight;
                     e.weight = newWeight;
                     return true;
                 }
@@ -146,8 +214,13 @@ public:
             return false;
         };
 
-        return modifyEdgeWeight(adjList[from], from, to) &&
-               modifyEdgeWeight(adjList[to], to, from);
+        bool result = modifyEdgeWeight(adjList[from], from, to) &&
+                      modifyEdgeWeight(adjList[to], to, from);
+        if (result) {
+            router.edgeWeightChanged(from, to, oldWeight, newWeight);
+            logOp(RecordWriter().putInt(MODIFY_EDGE).putString(fromName).putString(toName).putInt(newWeight));
+        }
+        return result;
     }
 
     const vector<Edge> &getEdges(int node) const {
@@ -156,6 +229,17 @@ public:
 
     int getNodeCount() const { return nodeCount; }
 
+    // Cached shortest-path tree from a collection point; repeat queries are free
+    shared_ptr<const ShortestPathTree> shortestPaths(int source) const {
+        return router.shortestPaths(adjList, source);
+    }
+
+    // Pairwise distances between collection points, computed in parallel
+    DistanceMatrix distanceMatrix(const vector<int> &stops) const {
+        router.prepare(adjList);
+        return computeDistanceMatrix(router, stops);
+    }
+
     const string &getNodeName(int index) const {
         return nodeNames[index];
     }
@@ -178,25 +262,60 @@ public:
         }
     }
 
-    void saveGraphToFile() {
-        ofstream outFile("graph.txt");
-        if (outFile.is_open()) {
-            outFile << nodeCount << "\n";
-            for (const auto &name : nodeNames) {
-                outFile << name << "\n";
+    void saveGraphToFile(WalStore::SnapshotWriter &out) const {
+        out.put("graph", RecordWriter().putInt(nodeCount).putInt(nextOp).str());
+        for (int i = 0; i < nodeCount; ++i) {
+            RecordWriter node;
+            node.putString(nodeNames[i]).putInt(adjList[i].size());
+            for (const Edge &edge : adjList[i]) {
+                node.putInt(edge.to).putInt(edge.weight);
             }
-            for (const auto &edges : adjList) {
-                for (const auto &edge : edges) {
-                    outFile << edge.from << " " << edge.to << " " << edge.weight << "\n";
+            out.put("node:" + walKey(i), node.str());
+        }
+    }
+
+    void loadGraphFromFile() {
+        vector<pair<string, string>> records;
+        if (!store.open(records)) {
+            importGraphFromTextFile();
+            store.compact();
+            return;
+        }
+
+        long long snapshotOps = 0;
+        replaying = true;
+        for (const auto &record : records) {
+            const string &key = record.first;
+            RecordReader in(record.second);
+            if (key == "graph") {
+                nodeCount = in.getInt();
+                snapshotOps = nextOp = in.getInt();
+                nodeNames.assign(nodeCount, "");
+                adjList.assign(nodeCount, vector<Edge>());
+            } else if (key.compare(0, 5, "node:") == 0) {
+                int index = stoi(key.substr(5));
+                if (index < 0 || index >= nodeCount)
+                    continue;
+                nodeNames[index] = in.getString();
+                int edgeCount = in.getInt();
+                for (int e = 0; e < edgeCount; ++e) {
+                    int to = in.getInt();
+                    adjList[index].push_back(Edge(index, to, in.getInt()));
                 }
+            } else if (key.compare(0, 3, "op:") == 0) {
+                long long sequence = stoll(key.substr(3));
+                if (sequence < snapshotOps)
+                    continue; // already folded into the snapshot
+                replayOp(in);
+                nextOp = sequence + 1;
             }
-            outFile.close();
-        } else {
-            cerr << "Unable to open file for saving graph.\n";
         }
+        replaying = false;
+        router.clear();
     }
 
-    void loadGraphFromFile() {
+    // One-time migration from the old space-delimited graph.txt
+    void importGraphFromTextFile() {
         ifstream inFile("graph.txt");
         if (inFile.is_open()) {
             inFile >> nodeCount;
@@ -211,6 +330,7 @@ public:
                 adjList[from].push_back(Edge(from, to, weight));
             }
             inFile.close();
+            router.clear();
         } else {
             cerr << "Unable to open file for loading graph.\n";
         }
@@ -231,39 +351,8 @@ void dijkstra(const Graph &graph, const string &startName) {
         return;
     }
 
-    vector<int> distances(nodeCount, INT_MAX);
-    vector<bool> visited(nodeCount, false);
-    vector<int> previous(nodeCount, -1); // To track the shortest path
-    distances[startNode] = 0;
-
-    for (int i = 0; i < nodeCount; i++) {
-        int minDist = INT_MAX;
-        int currentNode = -1;
-
-        // Find unvisited node with minimum distance
-        for (int j = 0; j < nodeCount; j++) {
-            if (!visited[j] && distances[j] < minDist) {
-                minDist = distances[j];
-                currentNode = j;
-            }
-        }
-
-        if (currentNode == -1)
-            break;
-        visited[currentNode] = true;
-
-        // Update distances through current node
-        const vector<Edge> &edges = graph.getEdges(currentNode);
-        for (const Edge &edge : edges) {
-            if (!visited[edge.to]) {
-                int newDist = distances[currentNode] + edge.weight;
-                if (newDist < distances[edge.to]) {
-                    distances[edge.to] = newDist;
-                    previous[edge.to] = currentNode;
-                }
-            }
-        }
-    }
+    shared_ptr<const ShortestPathTree> tree = graph.shortestPaths(startNode);
+    const vector<int> &distances = tree->distances;
 
     // Display results
     cout << "\nShortest paths from collection point " << startName << ":\n";
@@ -287,19 +376,82 @@ void dijkstra(const Graph &graph, const string &startName) {
     // Display the shortest path
     if (targetNode != -1) {
         cout << "\nShortest path to collection point " << graph.getNodeName(targetNode) << " (Distance: " << shortestDist << "):\n";
-
-        stack<int> path;
-        int currentNode = targetNode;
-        while (currentNode != -1) {
-            path.push(currentNode);
-            currentNode = previous[currentNode];
+        for (int node : tree->pathTo(targetNode)) {
+            cout << graph.getNodeName(node) << " ";
         }
+        cout << endl;
+    }
+}
+
+// Synthetic city graph: a street grid with random block lengths plus a few arterial shortcuts
+vector<vector<Edge>> generateCityGraph(int nodeCount, unsigned seed) {
+    mt19937 rng(seed);
+    uniform_int_distribution<int> blockLength(1, 100);
+    uniform_int_distribution<int> anyNode(0, nodeCount - 1);
+    vector<vector<Edge>> adjList(nodeCount);
 
-        while (!path.empty()) {
-            cout << graph.getNodeName(path.top()) << " ";
-            path.pop();
+    auto connect = [&adjList](int from, int to, int weight) {
+        adjList[from].push_back(Edge(from, to, weight));
+        adjList[to].push_back(Edge(to, from, weight));
+    };
+
+    int width = max(1, (int)sqrt((double)nodeCount));
+    for (int i = 0; i < nodeCount; ++i) {
+        if ((i + 1) % width != 0 && i + 1 < nodeCount)
+            connect(i, i + 1, blockLength(rng));
+        if (i + width < nodeCount)
+            connect(i, i + width, blockLength(rng));
+    }
+    for (int i = 0; i < nodeCount / 50; ++i)
+        connect(anyNode(rng), anyNode(rng), 5 * blockLength(rng));
+    return adjList;
+}
+
+volatile long long benchmarkSink; // keeps benchmark results observable
+
+// Routing benchmark: uncached and cached queries/sec on 1k to 1M collection points
+void runRoutingBenchmark() {
+    typedef chrono::steady_clock Clock;
+    cout << setw(10) << "nodes" << setw(12) << "edges" << setw(16) << "build (ms)"
+         << setw(18) << "queries/sec" << setw(20) << "cached queries/sec" << "\n";
+
+    for (int nodeCount : {1000, 10000, 100000, 1000000}) {
+        vector<vector<Edge>> adjList = generateCityGraph(nodeCount, 42);
+        RoutingEngine engine(16);
+
+        auto start = Clock::now();
+        engine.rebuild(adjList);
+        double buildMs = chrono::duration<double, milli>(Clock::now() - start).count();
+
+        int queries = max(10, min(1000, 20000000 / nodeCount));
+        mt19937 rng(7);
+        uniform_int_distribution<int> anyNode(0, nodeCount - 1);
+        long long checksum = 0;
+
+        start = Clock::now();
+        for (int q = 0; q < queries; ++q)
+            checksum += engine.computeTree(anyNode(rng)).distances[0];
+        double coldSeconds = chrono::duration<double>(Clock::now() - start).count();
+
+        // Dispatcher pattern: a handful of depots queried over and over
+        vector<int> depots;
+        for (int d = 0; d < 8; ++d) {
+            depots.push_back(anyNode(rng));
+            engine.shortestPaths(adjList, depots.back());
         }
-        cout << endl;
+        int cachedQueries = 1000000;
+        start = Clock::now();
+        for (int q = 0; q < cachedQueries; ++q)
+            checksum += engine.shortestPaths(adjList, depots[q % depots.size()])->distances[0];
+        double warmSeconds = chrono::duration<double>(Clock::now() - start).count();
+
+        size_t edgeCount = 0;
+        for (const auto &edges : adjList)
+            edgeCount += edges.size();
+        cout << setw(10) << nodeCount << setw(12) << edgeCount / 2 << setw(16) << fixed << setprecision(1) << buildMs
+             << setw(18) << setprecision(1) << queries / coldSeconds
+             << setw(20) << setprecision(0) << cachedQueries / warmSeconds << "\n";
+        benchmarkSink = checksum;
     }
 }
 
@@ -402,7 +554,53 @@ bool getValidInput(T &input, const string &prompt) {
     return true;
 }
 
-int main() {
+// Planner benchmark: 1,000+ full bins on a 20k-point city, matrix then savings + 2-opt
+void runPlannerBenchmark() {
+    typedef chrono::steady_clock Clock;
+    vector<vector<Edge>> adjList = generateCityGraph(20000, 42);
+    RoutingEngine engine(0);
+    engine.rebuild(adjList);
+
+    cout << "threads: " << max(1u, thread::hardware_concurrency()) << "\n";
+    cout << setw(8) << "bins" << setw(14) << "matrix (ms)" << setw(12) << "plan (ms)"
+         << setw(10) << "trucks" << setw(12) << "unserved" << setw(16) << "total distance" << "\n";
+
+    for (int binCount : {250, 1000, 2000}) {
+        mt19937 rng(binCount);
+        uniform_int_distribution<int> anyNode(0, (int)adjList.size() - 1);
+        uniform_int_distribution<int> binLoad(1, 10);
+
+        vector<int> stops(1, anyNode(rng)); // stop 0 is the depot
+        vector<int> demand(1, 0);
+        for (int b = 0; b < binCount; ++b) {
+            stops.push_back(anyNode(rng));
+            demand.push_back(binLoad(rng));
+        }
+
+        auto start = Clock::now();
+        DistanceMatrix matrix = computeDistanceMatrix(engine, stops);
+        double matrixMs = chrono::duration<double, milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        CollectionPlan plan = planCollectionRoutes(matrix, 0, demand, 100, binCount / 8);
+        double planMs = chrono::duration<double, milli>(Clock::now() - start).count();
+
+        cout << setw(8) << binCount << setw(14) << fixed << setprecision(1) << matrixMs << setw(12) << planMs
+             << setw(10) << plan.routes.size() << setw(12) << plan.unserved.size()
+             << setw(16) << plan.totalDistance << "\n";
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && string(argv[1]) == "--bench-routing") {
+        runRoutingBenchmark();
+        return 0;
+    }
+    if (argc > 1 && string(argv[1]) == "--bench-planner") {
+        runPlannerBenchmark();
+        return 0;
+    }
+
     LoginSystem loginSystem;
     Graph cityGraph;
 
@@ -4,6 +4,11 @@
 #include <vector>
 #include <algorithm>
 #include <fstream>
+#include <limits>
+#include <chrono>
+#include <iomanip>
+#include "Write_ahead_log.h"
+#include "Search_index.h"
 
 using namespace std;
 
@@ -71,22 +76,67 @@ public:
 class RecycledProductMarketplace {
 private:
     unordered_map<string, vector<Product>> productCatalog; // Maps categories to products
+    WalStore store;
+    long long nextProductKey; // products are append-only, keyed by insertion sequence
 
-    void saveProductsToFile() {
-        ofstream outFile("products.txt");
-        if (outFile.is_open()) {
-            for (const auto &pair : productCatalog) {
-                for (const auto &product : pair.second) {
-                    outFile << product.category << "," << product.name << "," << product.price << "\n";
-                }
+    // Search index over name and category, faceted by category with price order.
+    // documents[d] locates index document d inside productCatalog.
+    enum { NAME_FIELD, CATEGORY_FIELD, PRODUCT_FIELD_COUNT };
+    SearchIndex index;
+    vector<pair<const vector<Product> *, int>> documents;
+
+    void indexProduct(const vector<Product> &categoryProducts, int position) {
+        const Product &product = categoryProducts[position];
+        index.add({product.name, product.category}, product.category, product.price);
+        documents.emplace_back(&categoryProducts, position);
+    }
+
+    vector<const Product *> productsFor(const vector<int> &docs) const {
+        vector<const Product *> result;
+        result.reserve(docs.size());
+        for (int doc : docs) {
+            result.push_back(&(*documents[doc].first)[documents[doc].second]);
+        }
+        return result;
+    }
+
+    static string encodeProduct(const Product &product) {
+        return RecordWriter().putString(product.category).putString(product.name).putDouble(product.price).str();
+    }
+
+    // Snapshot keys are renumbered from 0, but nextProductKey is left alone: if
+    // the compaction fails, the old log still holds keys up to it
+    void saveProductsToFile(WalStore::SnapshotWriter &out) const {
+        long long key = 0;
+        for (const auto &pair : productCatalog) {
+            for (const auto &product : pair.second) {
+                out.put(walKey(key++), encodeProduct(product));
             }
-            outFile.close();
-        } else {
-            cerr << "Unable to open file for saving products.\n";
         }
     }
 
     void loadProductsFromFile() {
+        vector<pair<string, string>> records;
+        if (!store.open(records)) {
+            importProductsFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records) {
+            RecordReader in(record.second);
+            string category = in.getString();
+            string name = in.getString();
+            double price = in.getDouble();
+            vector<Product> &categoryProducts = productCatalog[category];
+            categoryProducts.emplace_back(name, category, price);
+            indexProduct(categoryProducts, categoryProducts.size() - 1);
+            nextProductKey = max(nextProductKey, stoll(record.first) + 1);
+        }
+    }
+
+    // One-time migration from the old comma-separated products.txt
+    void importProductsFromTextFile() {
         ifstream inFile("products.txt");
         if (inFile.is_open()) {
             string line;
@@ -96,7 +146,10 @@ private:
                 string category = line.substr(0, pos1);
                 string name = line.substr(pos1 + 1, pos2 - pos1 - 1);
                 double price = stod(line.substr(pos2 + 1));
-                productCatalog[category].emplace_back(name, category, price);
+                vector<Product> &categoryProducts = productCatalog[category];
+                categoryProducts.emplace_back(name, category, price);
+                indexProduct(categoryProducts, categoryProducts.size() - 1);
+                nextProductKey++;
             }
             inFile.close();
         } else {
@@ -105,16 +158,20 @@ private:
     }
 
 public:
-    RecycledProductMarketplace() {
+    RecycledProductMarketplace()
+        : store("products", [this](WalStore::SnapshotWriter &out) { saveProductsToFile(out); }), nextProductKey(0),
+          index(PRODUCT_FIELD_COUNT) {
         loadProductsFromFile();
     }
 
-    ~RecycledProductMarketplace() {
-        saveProductsToFile();
-    }
-
+    // The category argument is the catalog key; the stored product, its facet
+    // and its log record all take it, whatever product.category said
     void addProduct(const string &category, const Product &product) {
-        productCatalog[category].push_back(product);
+        vector<Product> &categoryProducts = productCatalog[category];
+        categoryProducts.push_back(product);
+        categoryProducts.back().category = category;
+        indexProduct(categoryProducts, categoryProducts.size() - 1);
+        store.put(walKey(nextProductKey++), encodeProduct(categoryProducts.back()));
         cout << "Added product: " << product.name << " in category: " << category << "\n";
     }
 
@@ -128,23 +185,108 @@ public:
         }
     }
 
-    vector<Product> searchProducts(const string &category) {
-        vector<Product> result;
-        if (productCatalog.find(category) != productCatalog.end()) {
-            result = productCatalog[category];
-        }
-        return result;
+    // Search results point into the catalog and stay valid until the next addProduct
+
+    // Up to limit products of a category priced at or below maxPrice, cheapest first
+    vector<const Product *> searchProducts(const string &category, double maxPrice = numeric_limits<double>::infinity(),
+                                           size_t limit = SIZE_MAX) const {
+        return productsFor(index.cheapest(category, maxPrice, limit));
+    }
+
+    // Products whose name or category contains text, case-insensitive
+    vector<const Product *> searchProductsByText(const string &text, size_t limit = SIZE_MAX) const {
+        return productsFor(index.findSubstring(text, SearchIndex::ALL_FIELDS, limit));
+    }
+
+    // Products with a word in the name starting with prefix (type-ahead)
+    vector<const Product *> searchProductsByPrefix(const string &prefix) const {
+        return productsFor(index.findPrefix(prefix, 1u << NAME_FIELD));
+    }
+};
+
+// --bench-search: category/price top-k and name search, index vs copy-and-sort
+void runSearchBenchmark() {
+    typedef chrono::steady_clock Clock;
+    auto secondsSince = [](Clock::time_point start) {
+        return chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    const char *categories[] = {"Furniture", "Clothing", "Stationery", "Decor", "Bags", "Toys", "Garden", "Kitchen"};
+    const char *materials[] = {"Bamboo", "Denim", "Cardboard", "Glass", "Tyre", "Plastic", "Jute", "Metal"};
+    const char *items[] = {"Chair", "Tote", "Notebook", "Lamp", "Planter", "Coaster", "Shelf", "Wallet"};
+    const int productCount = 1000000;
+    const int queryCount = 50;
+
+    srand(5);
+    vector<Product> generated;
+    for (int i = 0; i < productCount; i++) {
+        generated.emplace_back(string(materials[rand() % 8]) + " " + items[rand() % 8] + " #" + to_string(i),
+                               categories[rand() % 8], 1 + rand() % 50000 / 100.0);
+    }
+
+    // What searchProducts + sortProductsByPrice used to do per query
+    unordered_map<string, vector<Product>> catalog;
+    for (const Product &product : generated) {
+        catalog[product.category].push_back(product);
+    }
+
+    Clock::time_point start = Clock::now();
+    SearchIndex index(2);
+    for (const Product &product : generated) {
+        index.add({product.name, product.category}, product.category, product.price);
     }
+    double buildSeconds = secondsSince(start);
 
-    void sortProductsByPrice(vector<Product> &products) {
-        // Sort by price in ascending order
-        sort(products.begin(), products.end(), [](const Product &a, const Product &b) {
+    size_t checksum = 0;
+    start = Clock::now();
+    for (int q = 0; q < queryCount; q++) {
+        vector<Product> result = catalog[categories[q % 8]];
+        sort(result.begin(), result.end(), [](const Product &a, const Product &b) {
             return a.price < b.price;
         });
+        for (size_t i = 0; i < result.size() && i < 10 && result[i].price <= 100; i++)
+            checksum++;
+    }
+    double copySortSeconds = secondsSince(start);
+
+    start = Clock::now();
+    for (int q = 0; q < queryCount; q++) {
+        checksum += index.cheapest(categories[q % 8], 100, 10).size();
+    }
+    double topKSeconds = secondsSince(start);
+
+    start = Clock::now();
+    for (int q = 0; q < queryCount; q++) {
+        string needle = string(materials[q % 8]) + " " + items[q / 8 % 8] + " #1234";
+        for (const Product &product : generated) {
+            checksum += product.name.find(needle) != string::npos;
+        }
+    }
+    double scanSeconds = secondsSince(start);
+
+    start = Clock::now();
+    for (int q = 0; q < queryCount; q++) {
+        string needle = string(materials[q % 8]) + " " + items[q / 8 % 8] + " #1234";
+        checksum += index.findSubstring(needle, 1u << 0).size();
+    }
+    double substringSeconds = secondsSince(start);
+
+    cout << fixed << setprecision(3);
+    cout << "Marketplace search benchmark (" << productCount << " products, " << queryCount << " queries each)\n";
+    cout << "  index build:                 " << buildSeconds << " s\n";
+    cout << "  top-10 under $100, copy+sort: " << copySortSeconds * 1000 / queryCount << " ms/query\n";
+    cout << "  top-10 under $100, index:     " << topKSeconds * 1000 / queryCount << " ms/query\n";
+    cout << "  name substring, linear scan:  " << scanSeconds * 1000 / queryCount << " ms/query\n";
+    cout << "  name substring, index:        " << substringSeconds * 1000 / queryCount << " ms/query\n";
+    cout << "  (checksum " << checksum << ")\n";
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && string(argv[1]) == "--bench-search") {
+        runSearchBenchmark();
+        return 0;
     }
-};
 
-int main() {
     LoginSystem loginSystem;
     RecycledProductMarketplace marketplace;
 
@@ -201,36 +343,58 @@ int main() {
             do {
                 cout << "\nUser Dashboard\n";
                 cout << "1. Search Products\n";
-                cout << "2. Logout\n";
+                cout << "2. Search Products by Name\n";
+                cout << "3. Logout\n";
                 cout << "Enter your choice: ";
                 cin >> userChoice;
 
                 switch (userChoice) {
                 case 1: {
                     string category;
+                    double maxPrice;
                     cin.ignore();
                     cout << "Enter category to search: ";
                     getline(cin, category);
-                    auto products = marketplace.searchProducts(category);
+                    cout << "Enter maximum price (0 for no limit): ";
+                    cin >> maxPrice;
+                    if (maxPrice <= 0) {
+                        maxPrice = numeric_limits<double>::infinity();
+                    }
+                    auto products = marketplace.searchProducts(category, maxPrice);
                     if (products.empty()) {
                         cout << "No products found in this category.\n";
                     } else {
-                        marketplace.sortProductsByPrice(products);
                         cout << "Products in category: " << category << "\n";
-                        for (const auto &product : products) {
-                            cout << "  Name: " << product.name
-                                 << ", Price: $" << product.price << "\n";
+                        for (const auto *product : products) {
+                            cout << "  Name: " << product->name
+                                 << ", Price: $" << product->price << "\n";
+                        }
+                    }
+                    break;
+                }
+                case 2: {
+                    string text;
+                    cin.ignore();
+                    cout << "Enter product name or keyword: ";
+                    getline(cin, text);
+                    auto products = marketplace.searchProductsByText(text);
+                    if (products.empty()) {
+                        cout << "No products found.\n";
+                    } else {
+                        for (const auto *product : products) {
+                            cout << "  Name: " << product->name << ", Category: " << product->category
+                                 << ", Price: $" << product->price << "\n";
                         }
                     }
                     break;
                 }
-                case 2:
+                case 3:
                     cout << "Logging out...\n";
                     break;
                 default:
                     cout << "Invalid choice. Try again.\n";
                 }
-            } while (userChoice != 2);
+            } while (userChoice != 3);
             break;
         }
         case 3:
@@ -0,0 +1,525 @@
+// Routing_engine.h
+// Shared routing core of the collection-point graphs: a CSR copy of the adjacency
+// list with cached Dijkstra trees, bin-to-bin distance matrices and the
+// capacity-constrained multi-truck planner. Templated on the edge weight, since
+// the standalone tracker stores whole kilometres (int) and the SMART-CITY graph
+// stores fractional ones (float); each module names its instantiation, e.g.
+//
+//     typedef BasicRoutingEngine<int> RoutingEngine;
+//
+// Unreachable distances are numeric_limits<Weight>::max() (INT_MAX / FLT_MAX).
+#ifndef ROUTING_ENGINE_H
+#define ROUTING_ENGINE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Parallel_for.h"
+
+template <typename Weight>
+struct RoutingTraits {
+    static constexpr Weight UNREACHABLE = std::numeric_limits<Weight>::max();
+
+    // Sums over several legs: long long for integer weights, double otherwise
+    typedef typename std::conditional<std::is_integral<Weight>::value, long long, double>::type Total;
+};
+
+template <typename Weight>
+struct WeightedEdge {
+    int from;
+    int to;
+    Weight weight;
+    WeightedEdge(int from, int to, Weight weight) : from(from), to(to), weight(weight) {}
+    WeightedEdge() : from(0), to(0), weight(0) {}
+};
+
+// Shortest-path tree for one source, returned as data instead of printed
+template <typename Weight>
+struct BasicShortestPathTree {
+    int source;
+    std::vector<Weight> distances; // UNREACHABLE when unreachable
+    std::vector<int> previous;     // -1 for the source and unreachable points
+
+    bool reachable(int node) const {
+        return distances[node] != RoutingTraits<Weight>::UNREACHABLE;
+    }
+
+    std::vector<int> pathTo(int target) const {
+        std::vector<int> path;
+        if (!reachable(target))
+            return path;
+        for (int node = target; node != -1; node = previous[node])
+            path.push_back(node);
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+// Routing engine over a compact CSR copy of the adjacency list.
+// Trees are cached per source; graph mutations drop only the trees they affect.
+template <typename Weight>
+class BasicRoutingEngine {
+public:
+    typedef WeightedEdge<Weight> Edge;
+    typedef BasicShortestPathTree<Weight> Tree;
+    typedef std::vector<std::vector<Edge>> AdjacencyList;
+
+private:
+    static constexpr Weight UNREACHABLE = RoutingTraits<Weight>::UNREACHABLE;
+
+    std::vector<int> offsets; // CSR row starts, size nodeCount + 1
+    std::vector<int> targets;
+    std::vector<Weight> weights;
+    bool csrDirty;
+    size_t cacheCapacity;
+    std::unordered_map<int, std::shared_ptr<const Tree>> cache;
+    std::deque<int> cacheOrder; // oldest cached source first
+
+    void forget(int source) {
+        cache.erase(source);
+        cacheOrder.erase(std::remove(cacheOrder.begin(), cacheOrder.end(), source), cacheOrder.end());
+    }
+
+    template <typename Pred>
+    void forgetIf(Pred affected) {
+        std::vector<int> stale;
+        for (const auto &entry : cache) {
+            if (affected(*entry.second))
+                stale.push_back(entry.first);
+        }
+        for (int source : stale)
+            forget(source);
+    }
+
+    void forgetTreesShortenedBy(int from, int to, Weight weight) {
+        forgetIf([from, to, weight](const Tree &tree) {
+            const std::vector<Weight> &d = tree.distances;
+            return (d[from] != UNREACHABLE && d[from] + weight < d[to]) ||
+                   (d[to] != UNREACHABLE && d[to] + weight < d[from]);
+        });
+    }
+
+    void forgetTreesUsing(int from, int to) {
+        forgetIf([from, to](const Tree &tree) {
+            return tree.previous[to] == from || tree.previous[from] == to;
+        });
+    }
+
+public:
+    explicit BasicRoutingEngine(size_t cacheCapacity = 32) : csrDirty(true), cacheCapacity(cacheCapacity) {}
+
+    void rebuild(const AdjacencyList &adjList) {
+        int nodeCount = adjList.size();
+        offsets.assign(nodeCount + 1, 0);
+        for (int i = 0; i < nodeCount; ++i)
+            offsets[i + 1] = offsets[i] + adjList[i].size();
+
+        targets.resize(offsets[nodeCount]);
+        weights.resize(offsets[nodeCount]);
+        for (int i = 0; i < nodeCount; ++i) {
+            int slot = offsets[i];
+            for (const Edge &e : adjList[i]) {
+                targets[slot] = e.to;
+                weights[slot] = e.weight;
+                ++slot;
+            }
+        }
+        csrDirty = false;
+    }
+
+    int nodeCount() const {
+        return offsets.empty() ? 0 : offsets.size() - 1;
+    }
+
+    // Uncached binary-heap Dijkstra over the current CSR arrays.
+    // Safe to call concurrently once the CSR is built.
+    Tree computeTree(int source) const {
+        int n = nodeCount();
+        Tree tree;
+        tree.source = source;
+        tree.distances.assign(n, UNREACHABLE);
+        tree.previous.assign(n, -1);
+        if (source < 0 || source >= n)
+            return tree;
+
+        typedef std::pair<Weight, int> HeapEntry; // (distance, node)
+        std::vector<HeapEntry> heap;
+        heap.reserve(n);
+        tree.distances[source] = 0;
+        heap.push_back(HeapEntry(0, source));
+
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+            HeapEntry top = heap.back();
+            heap.pop_back();
+
+            int node = top.second;
+            if (top.first > tree.distances[node])
+                continue; // stale entry
+
+            for (int slot = offsets[node]; slot < offsets[node + 1]; ++slot) {
+                int next = targets[slot];
+                Weight newDist = top.first + weights[slot];
+                if (newDist < tree.distances[next]) {
+                    tree.distances[next] = newDist;
+                    tree.previous[next] = node;
+                    heap.push_back(HeapEntry(newDist, next));
+                    std::push_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+                }
+            }
+        }
+        return tree;
+    }
+
+    // Distances from source to each target only; the search stops once every target is settled
+    std::vector<Weight> distancesTo(int source, const std::vector<int> &stops) const {
+        int n = nodeCount();
+        std::vector<Weight> distances(n, UNREACHABLE);
+        std::vector<char> isTarget(n, 0);
+        int remaining = 0;
+        for (int stop : stops) {
+            if (stop >= 0 && stop < n && !isTarget[stop]) {
+                isTarget[stop] = 1;
+                remaining++;
+            }
+        }
+
+        typedef std::pair<Weight, int> HeapEntry; // (distance, node)
+        std::vector<HeapEntry> heap;
+        if (source >= 0 && source < n) {
+            distances[source] = 0;
+            heap.push_back(HeapEntry(0, source));
+        }
+
+        while (!heap.empty() && remaining > 0) {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+            HeapEntry top = heap.back();
+            heap.pop_back();
+
+            int node = top.second;
+            if (top.first > distances[node])
+                continue; // stale entry
+            if (isTarget[node]) {
+                isTarget[node] = 0;
+                remaining--;
+            }
+
+            for (int slot = offsets[node]; slot < offsets[node + 1]; ++slot) {
+                int next = targets[slot];
+                Weight newDist = top.first + weights[slot];
+                if (newDist < distances[next]) {
+                    distances[next] = newDist;
+                    heap.push_back(HeapEntry(newDist, next));
+                    std::push_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+                }
+            }
+        }
+
+        std::vector<Weight> result(stops.size(), UNREACHABLE);
+        for (size_t i = 0; i < stops.size(); ++i) {
+            if (stops[i] >= 0 && stops[i] < n)
+                result[i] = distances[stops[i]];
+        }
+        return result;
+    }
+
+    // Builds the CSR arrays if the graph changed since the last build
+    void prepare(const AdjacencyList &adjList) {
+        if (csrDirty)
+            rebuild(adjList);
+    }
+
+    bool isCached(int source) const {
+        return cache.count(source) != 0;
+    }
+
+    std::shared_ptr<const Tree> shortestPaths(const AdjacencyList &adjList, int source) {
+        auto cached = cache.find(source);
+        if (cached != cache.end())
+            return cached->second;
+
+        prepare(adjList);
+
+        auto tree = std::make_shared<const Tree>(computeTree(source));
+        if (cacheCapacity == 0)
+            return tree;
+        while (cache.size() >= cacheCapacity && !cacheOrder.empty()) {
+            cache.erase(cacheOrder.front());
+            cacheOrder.pop_front();
+        }
+        cache[source] = tree;
+        cacheOrder.push_back(source);
+        return tree;
+    }
+
+    // A new or cheaper edge only matters to trees it can shorten.
+    void edgeAdded(int from, int to, Weight weight) {
+        csrDirty = true;
+        forgetTreesShortenedBy(from, to, weight);
+    }
+
+    void edgeWeightChanged(int from, int to, Weight oldWeight, Weight newWeight) {
+        // Patch the CSR in place; the first matching slot mirrors the adjacency list order
+        if (!csrDirty) {
+            auto patch = [this, newWeight](int u, int v) {
+                for (int slot = offsets[u]; slot < offsets[u + 1]; ++slot) {
+                    if (targets[slot] == v) {
+                        weights[slot] = newWeight;
+                        return;
+                    }
+                }
+            };
+            patch(from, to);
+            patch(to, from);
+        }
+
+        if (newWeight < oldWeight)
+            forgetTreesShortenedBy(from, to, newWeight);
+        else if (newWeight > oldWeight)
+            forgetTreesUsing(from, to);
+    }
+
+    // A dearer or removed edge only matters to trees that route over it.
+    void edgeDeleted(int from, int to) {
+        csrDirty = true;
+        forgetTreesUsing(from, to);
+    }
+
+    void nodeAdded() {
+        csrDirty = true;
+        for (auto &entry : cache) {
+            auto grown = std::make_shared<Tree>(*entry.second);
+            grown->distances.push_back(UNREACHABLE);
+            grown->previous.push_back(-1);
+            entry.second = grown;
+        }
+    }
+
+    // Trees that route through the node are dropped; the rest are renumbered.
+    void nodeDeleted(int node) {
+        csrDirty = true;
+        forgetIf([node](const Tree &tree) {
+            return tree.source == node ||
+                   std::find(tree.previous.begin(), tree.previous.end(), node) != tree.previous.end();
+        });
+
+        std::unordered_map<int, std::shared_ptr<const Tree>> renumbered;
+        for (auto &entry : cache) {
+            auto tree = std::make_shared<Tree>(*entry.second);
+            tree->distances.erase(tree->distances.begin() + node);
+            tree->previous.erase(tree->previous.begin() + node);
+            for (int &p : tree->previous) {
+                if (p > node)
+                    p--;
+            }
+            if (tree->source > node)
+                tree->source--;
+            renumbered[tree->source] = tree;
+        }
+        cache.swap(renumbered);
+        for (int &source : cacheOrder) {
+            if (source > node)
+                source--;
+        }
+    }
+
+    void clear() {
+        cache.clear();
+        cacheOrder.clear();
+        csrDirty = true;
+    }
+
+    size_t cachedTrees() const {
+        return cache.size();
+    }
+};
+
+// Bin-to-bin distance matrix over a set of stops (row-major, UNREACHABLE when unreachable)
+template <typename Weight>
+struct BasicDistanceMatrix {
+    std::vector<int> stops; // graph node of each row/column
+    std::vector<Weight> cells;
+
+    Weight at(int i, int j) const {
+        return cells[(size_t)i * stops.size() + j];
+    }
+};
+
+// One early-exit Dijkstra per stop, spread across all cores
+template <typename Weight>
+BasicDistanceMatrix<Weight> computeDistanceMatrix(const BasicRoutingEngine<Weight> &engine,
+                                                  const std::vector<int> &stops, unsigned threadCount = 0) {
+    BasicDistanceMatrix<Weight> matrix;
+    matrix.stops = stops;
+    size_t n = stops.size();
+    matrix.cells.assign(n * n, RoutingTraits<Weight>::UNREACHABLE);
+
+    parallelFor(n, [&](int row) {
+        std::vector<Weight> distances = engine.distancesTo(stops[row], stops);
+        std::copy(distances.begin(), distances.end(), matrix.cells.begin() + (size_t)row * n);
+    }, threadCount);
+    return matrix;
+}
+
+// One truck's tour: depot -> stops... -> depot
+template <typename Weight>
+struct BasicVehicleRoute {
+    std::vector<int> stops; // matrix indices, depot excluded
+    int load;
+    Weight distance;
+};
+
+template <typename Weight>
+struct BasicCollectionPlan {
+    std::vector<BasicVehicleRoute<Weight>> routes;
+    std::vector<int> unserved; // matrix indices that are unreachable or exceed the fleet
+    typename RoutingTraits<Weight>::Total totalDistance;
+};
+
+// Tour length, UNREACHABLE if any leg is
+template <typename Weight>
+Weight routeDistance(const BasicDistanceMatrix<Weight> &matrix, int depot, const std::vector<int> &stops) {
+    typedef typename RoutingTraits<Weight>::Total Total;
+    if (stops.empty())
+        return 0;
+    Total total = (Total)matrix.at(depot, stops.front()) + matrix.at(stops.back(), depot);
+    for (size_t i = 1; i < stops.size(); ++i)
+        total += matrix.at(stops[i - 1], stops[i]);
+    return total > RoutingTraits<Weight>::UNREACHABLE ? RoutingTraits<Weight>::UNREACHABLE : (Weight)total;
+}
+
+// 2-opt: reverse segments while that shortens the tour
+template <typename Weight>
+void improveRouteTwoOpt(const BasicDistanceMatrix<Weight> &matrix, int depot, std::vector<int> &stops) {
+    typedef typename RoutingTraits<Weight>::Total Total;
+    int n = stops.size();
+    auto node = [&](int i) { return (i < 0 || i >= n) ? depot : stops[i]; };
+
+    bool improved = true;
+    while (improved) {
+        improved = false;
+        for (int i = 0; i < n - 1; ++i) {
+            for (int j = i + 1; j < n; ++j) {
+                Total before = (Total)matrix.at(node(i - 1), node(i)) + matrix.at(node(j), node(j + 1));
+                Total after = (Total)matrix.at(node(i - 1), node(j)) + matrix.at(node(i), node(j + 1));
+                if (after < before) {
+                    std::reverse(stops.begin() + i, stops.begin() + j + 1);
+                    improved = true;
+                }
+            }
+        }
+    }
+}
+
+// Capacity-constrained multi-truck plan: Clarke-Wright savings followed by 2-opt per route.
+// Matrix index `depot` is the start and end of every tour; demand[i] is the load of stop i.
+template <typename Weight>
+BasicCollectionPlan<Weight> planCollectionRoutes(const BasicDistanceMatrix<Weight> &matrix, int depot,
+                                                 const std::vector<int> &demand, int vehicleCapacity,
+                                                 int vehicleCount) {
+    typedef typename RoutingTraits<Weight>::Total Total;
+    typedef BasicVehicleRoute<Weight> VehicleRoute;
+    const Weight UNREACHABLE = RoutingTraits<Weight>::UNREACHABLE;
+
+    int n = matrix.stops.size();
+    BasicCollectionPlan<Weight> plan;
+    plan.totalDistance = 0;
+
+    // Start with one route per reachable stop
+    std::vector<std::deque<int>> routes(n);
+    std::vector<int> routeLoad(n, 0);
+    std::vector<int> routeOf(n, -1);
+    for (int i = 0; i < n; ++i) {
+        if (i == depot)
+            continue;
+        if (matrix.at(depot, i) == UNREACHABLE || demand[i] > vehicleCapacity) {
+            plan.unserved.push_back(i);
+            continue;
+        }
+        routes[i].push_back(i);
+        routeLoad[i] = demand[i];
+        routeOf[i] = i;
+    }
+
+    struct Saving {
+        Total value;
+        int i, j;
+        bool operator<(const Saving &other) const { return value > other.value; }
+    };
+    std::vector<Saving> savings;
+    for (int i = 0; i < n; ++i) {
+        if (routeOf[i] == -1)
+            continue;
+        for (int j = i + 1; j < n; ++j) {
+            if (routeOf[j] == -1 || matrix.at(i, j) == UNREACHABLE)
+                continue;
+            Total value = (Total)matrix.at(depot, i) + matrix.at(depot, j) - matrix.at(i, j);
+            if (value > 0)
+                savings.push_back({value, i, j});
+        }
+    }
+    std::sort(savings.begin(), savings.end());
+
+    // Merge two routes when i and j sit at route ends and the truck can carry both
+    for (const Saving &s : savings) {
+        int a = routeOf[s.i], b = routeOf[s.j];
+        if (a == b || routeLoad[a] + routeLoad[b] > vehicleCapacity)
+            continue;
+        std::deque<int> &ra = routes[a];
+        std::deque<int> &rb = routes[b];
+        if (ra.front() != s.i && ra.back() != s.i)
+            continue;
+        if (rb.front() != s.j && rb.back() != s.j)
+            continue;
+
+        if (ra.back() != s.i)
+            std::reverse(ra.begin(), ra.end());
+        if (rb.front() != s.j)
+            std::reverse(rb.begin(), rb.end());
+        for (int stop : rb) {
+            ra.push_back(stop);
+            routeOf[stop] = a;
+        }
+        routeLoad[a] += routeLoad[b];
+        routeLoad[b] = 0;
+        rb.clear();
+    }
+
+    for (int r = 0; r < n; ++r) {
+        if (routes[r].empty())
+            continue;
+        VehicleRoute route;
+        route.stops.assign(routes[r].begin(), routes[r].end());
+        route.load = routeLoad[r];
+        route.distance = 0;
+        plan.routes.push_back(route);
+    }
+
+    parallelFor(plan.routes.size(), [&](int r) {
+        improveRouteTwoOpt(matrix, depot, plan.routes[r].stops);
+        plan.routes[r].distance = routeDistance(matrix, depot, plan.routes[r].stops);
+    });
+
+    // Keep the heaviest tours when there are more tours than trucks
+    std::sort(plan.routes.begin(), plan.routes.end(), [](const VehicleRoute &x, const VehicleRoute &y) {
+        return x.load > y.load;
+    });
+    while ((int)plan.routes.size() > vehicleCount) {
+        for (int stop : plan.routes.back().stops)
+            plan.unserved.push_back(stop);
+        plan.routes.pop_back();
+    }
+    for (const VehicleRoute &route : plan.routes)
+        plan.totalDistance += route.distance;
+    return plan;
+}
+
+#endif
@@ -0,0 +1,216 @@
+// Search_index.h
+// Shared in-memory full-text index for the catalog style modules (food donations,
+// recycled products). Documents are numbered by the caller in insertion order and
+// are only ever added, so every posting list stays sorted by document id for free.
+//
+//   tokens    lowercase alphanumeric words -> postings    (exact and prefix lookup)
+//   trigrams  every 3 byte window of a field -> postings   (substring lookup)
+//   facets    facet value -> (price, document) ordered map  (cheapest-first top-k)
+//
+// A posting packs the document id with a bit mask of the fields it occurred in,
+// so a query can be limited to some fields without a second index.
+#ifndef SEARCH_INDEX_H
+#define SEARCH_INDEX_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class SearchIndex {
+public:
+    enum { MAX_FIELDS = 4, ALL_FIELDS = (1 << MAX_FIELDS) - 1 };
+
+private:
+    typedef uint32_t Posting; // document id << MAX_FIELDS | field mask
+
+    int fieldCount;
+    std::string corpus;                     // lowercased field text of every document
+    std::vector<uint32_t> fieldOffsets;     // document d, field f starts at [d * fieldCount + f]
+    std::map<std::string, std::vector<Posting>> tokens;
+    std::unordered_map<uint32_t, std::vector<Posting>> trigrams;
+    std::unordered_map<std::string, std::multimap<double, int>> facets;
+
+    static int documentOf(Posting posting) {
+        return posting >> MAX_FIELDS;
+    }
+
+    static void addPosting(std::vector<Posting> &postings, int doc, unsigned field) {
+        Posting posting = ((Posting)doc << MAX_FIELDS) | (1u << field);
+        if (!postings.empty() && documentOf(postings.back()) == doc)
+            postings.back() |= posting;
+        else
+            postings.push_back(posting);
+    }
+
+    static uint32_t trigramKey(const char *text) {
+        return (unsigned char)text[0] << 16 | (unsigned char)text[1] << 8 | (unsigned char)text[2];
+    }
+
+    static std::string lowercase(const std::string &text) {
+        std::string lower = text;
+        for (char &c : lower)
+            c = std::tolower((unsigned char)c);
+        return lower;
+    }
+
+    const char *fieldText(int doc, int field, size_t &length) const {
+        size_t slot = (size_t)doc * fieldCount + field;
+        length = fieldOffsets[slot + 1] - fieldOffsets[slot];
+        return corpus.data() + fieldOffsets[slot];
+    }
+
+    bool fieldContains(int doc, unsigned fieldMask, const std::string &needle) const {
+        if (needle.empty())
+            return true; // same as string::find("")
+        for (int field = 0; field < fieldCount; field++) {
+            if (!(fieldMask & (1u << field)))
+                continue;
+            size_t length;
+            const char *text = fieldText(doc, field, length);
+            if (search(text, text + length, needle.begin(), needle.end()) != text + length)
+                return true;
+        }
+        return false;
+    }
+
+public:
+    explicit SearchIndex(int fieldCount) : fieldCount(fieldCount) {
+        if (fieldCount < 1 || fieldCount > MAX_FIELDS)
+            throw std::invalid_argument("SearchIndex: unsupported field count");
+        fieldOffsets.push_back(0);
+    }
+
+    int size() const {
+        return (fieldOffsets.size() - 1) / fieldCount;
+    }
+
+    // Indexes the next document (its id is the previous size()). fields must have
+    // fieldCount entries; facet/price feed the cheapest-first lists when non-empty.
+    int add(const std::vector<std::string> &fields, const std::string &facet = "", double price = 0) {
+        int doc = size();
+        for (int field = 0; field < fieldCount; field++) {
+            size_t start = corpus.size();
+            corpus += lowercase(fields[field]);
+            fieldOffsets.push_back(corpus.size());
+
+            const char *text = corpus.data() + start;
+            size_t length = corpus.size() - start;
+            for (size_t i = 0; i + 3 <= length; i++)
+                addPosting(trigrams[trigramKey(text + i)], doc, field);
+
+            for (size_t i = 0; i < length;) {
+                if (!std::isalnum((unsigned char)text[i])) {
+                    i++;
+                    continue;
+                }
+                size_t end = i;
+                while (end < length && std::isalnum((unsigned char)text[end]))
+                    end++;
+                addPosting(tokens[std::string(text + i, end - i)], doc, field);
+                i = end;
+            }
+        }
+        if (!facet.empty())
+            facets[facet].emplace(price, doc);
+        return doc;
+    }
+
+    // Documents containing the whole word (case-insensitive), in id order
+    std::vector<int> findToken(const std::string &word, unsigned fieldMask = ALL_FIELDS) const {
+        std::vector<int> result;
+        auto found = tokens.find(lowercase(word));
+        if (found != tokens.end()) {
+            for (Posting posting : found->second) {
+                if (posting & fieldMask)
+                    result.push_back(documentOf(posting));
+            }
+        }
+        return result;
+    }
+
+    // Documents with a word starting with prefix, in id order
+    std::vector<int> findPrefix(const std::string &prefix, unsigned fieldMask = ALL_FIELDS) const {
+        std::vector<int> result;
+        std::string lower = lowercase(prefix);
+        for (auto it = tokens.lower_bound(lower); it != tokens.end() && it->first.compare(0, lower.size(), lower) == 0;
+             ++it) {
+            for (Posting posting : it->second) {
+                if (posting & fieldMask)
+                    result.push_back(documentOf(posting));
+            }
+        }
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+
+    // Documents where one of the selected fields contains text (case-insensitive),
+    // in id order. Candidates come from intersecting the query's trigram lists and
+    // are then checked against the stored field text.
+    std::vector<int> findSubstring(const std::string &text, unsigned fieldMask = ALL_FIELDS, size_t limit = SIZE_MAX) const {
+        std::vector<int> result;
+        std::string needle = lowercase(text);
+        if (needle.size() < 3) {
+            // Too short for a trigram; the packed corpus is still cheap to scan
+            for (int doc = 0; doc < size() && result.size() < limit; doc++) {
+                if (fieldContains(doc, fieldMask, needle))
+                    result.push_back(doc);
+            }
+            return result;
+        }
+
+        std::vector<const std::vector<Posting> *> lists;
+        for (size_t i = 0; i + 3 <= needle.size(); i++) {
+            auto found = trigrams.find(trigramKey(needle.data() + i));
+            if (found == trigrams.end())
+                return result;
+            lists.push_back(&found->second);
+        }
+        std::sort(lists.begin(), lists.end(), [](const std::vector<Posting> *a, const std::vector<Posting> *b) {
+            return a->size() != b->size() ? a->size() < b->size() : std::less<const std::vector<Posting> *>()(a, b);
+        });
+        lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+
+        std::vector<size_t> cursor(lists.size(), 0);
+        for (Posting candidate : *lists[0]) {
+            if (!(candidate & fieldMask))
+                continue;
+            int doc = documentOf(candidate);
+            bool inAll = true;
+            for (size_t l = 1; l < lists.size() && inAll; l++) {
+                const std::vector<Posting> &list = *lists[l];
+                size_t &at = cursor[l];
+                while (at < list.size() && documentOf(list[at]) < doc)
+                    at++;
+                inAll = at < list.size() && documentOf(list[at]) == doc;
+            }
+            if (inAll && fieldContains(doc, fieldMask, needle)) {
+                result.push_back(doc);
+                if (result.size() >= limit)
+                    break;
+            }
+        }
+        return result;
+    }
+
+    // Up to k documents of a facet priced at or below maxPrice, cheapest first.
+    // Walks the facet's ordered list directly; nothing is copied or sorted.
+    std::vector<int> cheapest(const std::string &facet, double maxPrice, size_t k = SIZE_MAX) const {
+        std::vector<int> result;
+        auto found = facets.find(facet);
+        if (found == facets.end())
+            return result;
+        for (auto it = found->second.begin(); it != found->second.end() && it->first <= maxPrice && result.size() < k;
+             ++it)
+            result.push_back(it->second);
+        return result;
+    }
+};
+
+#endif
@@ -2,9 +2,20 @@
 #include <vector>
 #include <queue>
 #include <map>
+#include <set>
 #include <string>
 #include <algorithm> // For remove function
 #include <fstream>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include "Write_ahead_log.h"
 
 using namespace std;
 
@@ -63,6 +74,253 @@ public:
     }
 };
 
+// One fill-level reading from a bin sensor
+struct TelemetryReading {
+    int binId;
+    float fillLevel;
+    long long timestamp;
+    long long enqueuedNs; // producer clock, used for apply latency
+};
+
+// Emitted when a bin that is not already queued for collection crosses the fill threshold
+struct CollectionEvent {
+    int binId;
+    float fillLevel;
+    long long timestamp;
+};
+
+// Lock-free single-producer/single-consumer ring buffer
+template <typename T>
+class SpscRingBuffer {
+private:
+    vector<T> slots;
+    size_t mask;
+    alignas(64) atomic<size_t> head; // next slot to read, owned by the consumer
+    alignas(64) atomic<size_t> tail; // next slot to write, owned by the producer
+
+public:
+    explicit SpscRingBuffer(size_t capacity) : head(0), tail(0) {
+        size_t size = 1;
+        while (size < capacity)
+            size <<= 1;
+        slots.resize(size);
+        mask = size - 1;
+    }
+
+    bool tryPush(const T &item) {
+        size_t t = tail.load(memory_order_relaxed);
+        if (t - head.load(memory_order_acquire) == slots.size())
+            return false;
+        slots[t & mask] = item;
+        tail.store(t + 1, memory_order_release);
+        return true;
+    }
+
+    size_t popBatch(T *out, size_t maxItems) {
+        size_t h = head.load(memory_order_relaxed);
+        size_t available = tail.load(memory_order_acquire) - h;
+        size_t count = min(available, maxItems);
+        for (size_t i = 0; i < count; ++i)
+            out[i] = slots[(h + i) & mask];
+        head.store(h + count, memory_order_release);
+        return count;
+    }
+};
+
+// Open-addressing bin id -> row index map (linear probing, no per-entry allocation).
+// INT_MIN marks an empty slot, so it is never a valid bin id.
+class FlatIdIndex {
+private:
+    enum { EMPTY = INT_MIN };
+    vector<int> keys;
+    vector<int> rows;
+    size_t mask;
+    size_t count;
+
+    size_t slotFor(int key) const {
+        return ((uint32_t)key * 2654435761u) & mask;
+    }
+
+    void grow() {
+        vector<int> oldKeys, oldRows;
+        oldKeys.swap(keys);
+        oldRows.swap(rows);
+        keys.assign(oldKeys.size() * 2, EMPTY);
+        rows.assign(oldKeys.size() * 2, -1);
+        mask = keys.size() - 1;
+        count = 0;
+        for (size_t i = 0; i < oldKeys.size(); ++i) {
+            if (oldKeys[i] != EMPTY)
+                insert(oldKeys[i], oldRows[i]);
+        }
+    }
+
+public:
+    FlatIdIndex() : keys(16, EMPTY), rows(16, -1), mask(15), count(0) {}
+
+    void insert(int key, int row) {
+        if (key == EMPTY)
+            return;
+        if ((count + 1) * 2 > keys.size())
+            grow();
+        size_t slot = slotFor(key);
+        while (keys[slot] != EMPTY && keys[slot] != key)
+            slot = (slot + 1) & mask;
+        if (keys[slot] == EMPTY)
+            count++;
+        keys[slot] = key;
+        rows[slot] = row;
+    }
+
+    int find(int key) const {
+        if (key == EMPTY)
+            return -1;
+        size_t slot = slotFor(key);
+        while (keys[slot] != EMPTY) {
+            if (keys[slot] == key)
+                return rows[slot];
+            slot = (slot + 1) & mask;
+        }
+        return -1;
+    }
+};
+
+// Structure-of-arrays bin table updated by the telemetry consumer
+struct BinTelemetryTable {
+    vector<int> ids;
+    vector<float> fillLevels;
+    vector<long long> lastUpdate;
+    vector<char> needsCollection;
+    vector<char> queued; // already waiting in the collection queue
+    FlatIdIndex index;
+
+    void addBin(int id, float fillLevel, bool flagged, bool alreadyQueued) {
+        index.insert(id, ids.size());
+        ids.push_back(id);
+        fillLevels.push_back(fillLevel);
+        lastUpdate.push_back(LLONG_MIN);
+        needsCollection.push_back(flagged);
+        queued.push_back(alreadyQueued);
+    }
+};
+
+struct TelemetryStats {
+    size_t applied = 0;
+    size_t stale = 0;     // older than the bin's last reading
+    size_t unknownBin = 0;
+    size_t malformed = 0;
+    double seconds = 0;
+    double p99LatencyUs = 0;
+};
+
+long long steadyNowNs() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Parses "id,fillLevel,timestamp"; returns false for malformed lines, including
+// ids outside (INT_MIN, INT_MAX]
+bool parseTelemetryLine(const string &line, TelemetryReading &reading) {
+    const char *p = line.c_str();
+    char *end;
+    long long id = strtoll(p, &end, 10);
+    if (end == p || *end != ',' || id <= INT_MIN || id > INT_MAX)
+        return false;
+    p = end + 1;
+    float fill = strtof(p, &end);
+    if (end == p || *end != ',')
+        return false;
+    p = end + 1;
+    long long timestamp = strtoll(p, &end, 10);
+    if (end == p)
+        return false;
+
+    reading.binId = id;
+    reading.fillLevel = fill;
+    reading.timestamp = timestamp;
+    return true;
+}
+
+// Producer thread parses the stream into a ring buffer; the calling thread applies
+// readings in batches. A bin is reported once, when it first crosses the threshold
+// while not queued; readings never clear needsCollection, only a collection does.
+TelemetryStats ingestTelemetryStream(istream &in, BinTelemetryTable &table, double fillThreshold,
+                                     vector<CollectionEvent> &events) {
+    const size_t BATCH = 256;
+    SpscRingBuffer<TelemetryReading> ring(1 << 16);
+    atomic<bool> producerDone(false);
+    atomic<size_t> malformed(0);
+    TelemetryStats stats;
+    vector<long long> latencies;
+
+    long long startNs = steadyNowNs();
+    thread producer([&]() {
+        string line;
+        TelemetryReading reading;
+        while (getline(in, line)) {
+            if (!parseTelemetryLine(line, reading)) {
+                if (!line.empty())
+                    malformed++;
+                continue;
+            }
+            reading.enqueuedNs = steadyNowNs();
+            while (!ring.tryPush(reading))
+                this_thread::yield();
+        }
+        producerDone.store(true, memory_order_release);
+    });
+
+    vector<TelemetryReading> batch(BATCH);
+    while (true) {
+        size_t count = ring.popBatch(batch.data(), BATCH);
+        if (count == 0) {
+            if (producerDone.load(memory_order_acquire)) {
+                count = ring.popBatch(batch.data(), BATCH);
+                if (count == 0)
+                    break;
+            } else {
+                this_thread::yield();
+                continue;
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            const TelemetryReading &r = batch[i];
+            int row = table.index.find(r.binId);
+            if (row == -1) {
+                stats.unknownBin++;
+                continue;
+            }
+            if (r.timestamp < table.lastUpdate[row]) {
+                stats.stale++;
+                continue;
+            }
+            table.fillLevels[row] = r.fillLevel;
+            table.lastUpdate[row] = r.timestamp;
+            if (r.fillLevel >= fillThreshold) {
+                table.needsCollection[row] = true;
+                if (!table.queued[row]) {
+                    table.queued[row] = true;
+                    events.push_back({r.binId, r.fillLevel, r.timestamp});
+                }
+            }
+            stats.applied++;
+        }
+
+        // The oldest reading in each batch has waited longest
+        latencies.push_back(steadyNowNs() - batch[0].enqueuedNs);
+    }
+    producer.join();
+
+    stats.seconds = (steadyNowNs() - startNs) / 1e9;
+    stats.malformed = malformed.load();
+    if (!latencies.empty()) {
+        size_t p99 = latencies.size() * 99 / 100;
+        nth_element(latencies.begin(), latencies.begin() + p99, latencies.end());
+        stats.p99LatencyUs = latencies[p99] / 1e3;
+    }
+    return stats;
+}
+
 class BinMonitoringSystem {
 private:
     struct Bin {
@@ -76,23 +334,63 @@ private:
     vector<Bin> bins;
     map<string, vector<int>> locationBins;
     queue<int> collectionQueue;
+    set<int> queuedBins; // ids currently in collectionQueue
 
     const double FILL_THRESHOLD = 80.0;
     bool isAdminLoggedIn;
+    WalStore store;
 
-    void saveBinsToFile() {
-        ofstream outFile("bins.txt");
-        if (outFile.is_open()) {
-            for (const auto &bin : bins) {
-                outFile << bin.id << "," << bin.location << "," << bin.fillLevel << "," << bin.needsCollection << "," << bin.underMaintenance << "\n";
-            }
-            outFile.close();
-        } else {
-            cerr << "Unable to open file for saving bins.\n";
+    // Adds a bin to the collection queue unless it is already waiting there
+    bool queueForCollection(int binId) {
+        if (!queuedBins.insert(binId).second)
+            return false;
+        collectionQueue.push(binId);
+        return true;
+    }
+
+    static string encodeBin(const Bin &bin) {
+        return RecordWriter().putInt(bin.id).putString(bin.location).putDouble(bin.fillLevel)
+            .putInt(bin.needsCollection).putInt(bin.underMaintenance).str();
+    }
+
+    // Appends one bin's current state to the log
+    void saveBin(const Bin &bin) {
+        store.put(walKey(bin.id), encodeBin(bin));
+    }
+
+    void saveBinsToFile(WalStore::SnapshotWriter &out) const {
+        for (const auto &bin : bins) {
+            out.put(walKey(bin.id), encodeBin(bin));
         }
     }
 
     void loadBinsFromFile() {
+        vector<pair<string, string>> records;
+        if (!store.open(records)) {
+            importBinsFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records) {
+            RecordReader in(record.second);
+            Bin bin;
+            bin.id = in.getInt();
+            bin.location = in.getString();
+            bin.fillLevel = in.getDouble();
+            bin.needsCollection = in.getInt();
+            bin.underMaintenance = in.getInt();
+
+            bins.push_back(bin);
+            locationBins[bin.location].push_back(bin.id);
+            if (bin.needsCollection) {
+                queueForCollection(bin.id);
+            }
+        }
+    }
+
+    // One-time migration from the old comma-separated bins.txt
+    void importBinsFromTextFile() {
         ifstream inFile("bins.txt");
         if (inFile.is_open()) {
             string line;
@@ -111,7 +409,7 @@ private:
                 bins.push_back({id, location, fillLevel, needsCollection, underMaintenance});
                 locationBins[location].push_back(id);
                 if (needsCollection) {
-                    collectionQueue.push(id);
+                    queueForCollection(id);
                 }
             }
             inFile.close();
@@ -121,14 +419,11 @@ private:
     }
 
 public:
-    BinMonitoringSystem() : isAdminLoggedIn(false) {
+    BinMonitoringSystem()
+        : isAdminLoggedIn(false), store("bins", [this](WalStore::SnapshotWriter &out) { saveBinsToFile(out); }) {
         loadBinsFromFile();
     }
 
-    ~BinMonitoringSystem() {
-        saveBinsToFile();
-    }
-
     void setAdminLoginStatus(bool status) {
         isAdminLoggedIn = status;
     }
@@ -165,6 +460,7 @@ public:
 
         bins.push_back(bin);
         locationBins[bin.location].push_back(bin.id);
+        saveBin(bin);
         cout << "Bin added successfully!\n";
     }
 
@@ -183,6 +479,7 @@ public:
                 cout << "Enter new location: ";
                 cin.ignore();
                 getline(cin, bin.location);
+                saveBin(bin);
                 cout << "Bin details updated successfully!\n";
                 return;
             }
@@ -206,6 +503,7 @@ public:
                     remove(locationBins[it->location].begin(), locationBins[it->location].end(), binId),
                     locationBins[it->location].end());
                 bins.erase(it);
+                store.erase(walKey(binId));
                 cout << "Bin deleted successfully!\n";
                 return;
             }
@@ -230,15 +528,45 @@ public:
 
                 if (bin.fillLevel >= FILL_THRESHOLD && !bin.needsCollection) {
                     bin.needsCollection = true;
-                    collectionQueue.push(bin.id);
+                    queueForCollection(bin.id);
                     cout << "Alert: Bin needs collection!\n";
                 }
+                saveBin(bin);
                 return;
             }
         }
         cout << "Bin not found.\n";
     }
 
+    // Telemetry mode: stream readings from a file or pipe, then fold them back into the bins
+    void ingestTelemetry(istream &in) {
+        BinTelemetryTable table;
+        for (const Bin &bin : bins) {
+            table.addBin(bin.id, bin.fillLevel, bin.needsCollection, queuedBins.count(bin.id) != 0);
+        }
+
+        vector<CollectionEvent> events;
+        TelemetryStats stats = ingestTelemetryStream(in, table, FILL_THRESHOLD, events);
+
+        for (size_t row = 0; row < bins.size(); ++row) {
+            if (table.lastUpdate[row] == LLONG_MIN)
+                continue; // no readings for this bin
+            bins[row].fillLevel = table.fillLevels[row];
+            bins[row].needsCollection = table.needsCollection[row];
+            saveBin(bins[row]);
+        }
+        for (const CollectionEvent &event : events) {
+            queueForCollection(event.binId);
+            cout << "Alert: Bin " << event.binId << " needs collection! (fill " << event.fillLevel
+                 << "% at " << event.timestamp << ")\n";
+        }
+
+        cout << "Applied " << stats.applied << " readings in " << stats.seconds << " s ("
+             << (stats.seconds > 0 ? stats.applied / stats.seconds : 0) << " updates/sec)\n";
+        cout << "Skipped: " << stats.stale << " stale, " << stats.unknownBin << " unknown bin, "
+             << stats.malformed << " malformed\n";
+    }
+
     void viewBinStatus() const {
         if (bins.empty()) {
             cout << "No bins available.\n";
@@ -271,7 +599,59 @@ public:
     }
 };
 
-int main() {
+// Replay benchmark: synthetic sensor stream through the full parse -> ring -> apply pipeline
+void runTelemetryBenchmark() {
+    const int BIN_COUNT = 100000;
+    const int READINGS = 5000000;
+    mt19937 rng(42);
+    uniform_int_distribution<int> anyBin(1, BIN_COUNT);
+    uniform_real_distribution<float> fill(0.0f, 100.0f);
+
+    string stream;
+    stream.reserve((size_t)READINGS * 24);
+    for (int i = 0; i < READINGS; ++i) {
+        char line[64];
+        snprintf(line, sizeof(line), "%d,%.1f,%d\n", anyBin(rng), fill(rng), 1700000000 + i);
+        stream += line;
+    }
+
+    BinTelemetryTable table;
+    for (int id = 1; id <= BIN_COUNT; ++id)
+        table.addBin(id, 0.0f, false, false);
+
+    istringstream in(stream);
+    vector<CollectionEvent> events;
+    TelemetryStats stats = ingestTelemetryStream(in, table, 80.0, events);
+
+    cout << fixed << setprecision(1);
+    cout << "bins:              " << BIN_COUNT << "\n";
+    cout << "readings applied:  " << stats.applied << "\n";
+    cout << "collection events: " << events.size() << "\n";
+    cout << "updates/sec:       " << stats.applied / stats.seconds << "\n";
+    cout << "p99 apply latency: " << stats.p99LatencyUs << " us\n";
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && string(argv[1]) == "--bench-telemetry") {
+        runTelemetryBenchmark();
+        return 0;
+    }
+    if (argc > 2 && string(argv[1]) == "--ingest") {
+        BinMonitoringSystem system;
+        string source = argv[2];
+        if (source == "-") {
+            system.ingestTelemetry(cin);
+        } else {
+            ifstream inFile(source);
+            if (!inFile.is_open()) {
+                cerr << "Unable to open telemetry file " << source << ".\n";
+                return 1;
+            }
+            system.ingestTelemetry(inFile);
+        }
+        return 0;
+    }
+
     LoginSystem loginSystem;
     BinMonitoringSystem system;
 
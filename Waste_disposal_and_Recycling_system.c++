@@ -1,6 +1,11 @@
 #include <iostream>
 #include <string>
 #include <fstream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include "Flat_containers.h"
 
 using namespace std;
 
@@ -23,31 +28,25 @@ struct Admin
     int password; // 5-digit positive integer password
 };
 
-// Node structure for linked list
-struct ItemNode
-{
-    string name;
-    ItemNode *next;
-    ItemNode(const string &itemName) : name(itemName), next(nullptr) {}
-};
-
 // Recycling System
+// Item names are kept in insertion order for display; membership checks go through
+// a perfect-hash set per list, rebuilt whenever an admin edits that list.
 class RecyclingSystem
 {
 private:
-    ItemNode *recyclableHead;
-    ItemNode *nonRecyclableHead;
+    vector<string> recyclableItems; // oldest first
+    vector<string> nonRecyclableItems;
+    PerfectHashSet recyclableIndex;
+    PerfectHashSet nonRecyclableIndex;
 
-    void saveItemsToFile(const string &filename, ItemNode *head)
+    void saveItemsToFile(const string &filename, const vector<string> &items)
     {
         ofstream outFile(filename);
         if (outFile.is_open())
         {
-            ItemNode *current = head;
-            while (current)
+            for (auto it = items.rbegin(); it != items.rend(); ++it) // newest first
             {
-                outFile << current->name << "\n";
-                current = current->next;
+                outFile << *it << "\n";
             }
             outFile.close();
         }
@@ -57,7 +56,7 @@ private:
         }
     }
 
-    void loadItemsFromFile(const string &filename, ItemNode *&head)
+    void loadItemsFromFile(const string &filename, vector<string> &items, PerfectHashSet &index)
     {
         ifstream inFile(filename);
         if (inFile.is_open())
@@ -65,10 +64,10 @@ private:
             string itemName;
             while (getline(inFile, itemName))
             {
-                ItemNode *newItem = new ItemNode(itemName);
-                newItem->next = head;
-                head = newItem;
+                items.push_back(itemName);
             }
+            reverse(items.begin(), items.end());
+            index.build(items);
             inFile.close();
         }
         else
@@ -77,35 +76,54 @@ private:
         }
     }
 
-public:
-    RecyclingSystem() : recyclableHead(nullptr), nonRecyclableHead(nullptr)
+    void addItem(vector<string> &items, PerfectHashSet &index, const string &lowerItemName)
     {
-        loadItemsFromFile("recyclable_items.txt", recyclableHead);
-        loadItemsFromFile("non_recyclable_items.txt", nonRecyclableHead);
+        items.push_back(lowerItemName);
+        index.build(items);
     }
 
-    ~RecyclingSystem()
+    bool deleteItem(vector<string> &items, PerfectHashSet &index, const string &lowerItemName)
     {
-        saveItemsToFile("recyclable_items.txt", recyclableHead);
-        saveItemsToFile("non_recyclable_items.txt", nonRecyclableHead);
+        auto found = find(items.rbegin(), items.rend(), lowerItemName);
+        if (found == items.rend())
+            return false;
+        items.erase(next(found).base());
+        index.build(items);
+        return true;
+    }
 
-        ItemNode *current = recyclableHead;
-        while (current)
-        {
-            ItemNode *toDelete = current;
-            current = current->next;
-            delete toDelete;
-        }
-        current = nonRecyclableHead;
-        while (current)
+    bool modifyItem(vector<string> &items, PerfectHashSet &index, const string &lowerOldName, const string &lowerNewName)
+    {
+        auto found = find(items.rbegin(), items.rend(), lowerOldName);
+        if (found == items.rend())
+            return false;
+        *found = lowerNewName;
+        index.build(items);
+        return true;
+    }
+
+    void displayItems(const vector<string> &items)
+    {
+        for (auto it = items.rbegin(); it != items.rend(); ++it)
         {
-            ItemNode *toDelete = current;
-            current = current->next;
-            delete toDelete;
+            cout << "- " << *it << "\n"; // Automatically in lowercase
         }
     }
 
-    // Add a recyclable item to the linked list
+public:
+    RecyclingSystem()
+    {
+        loadItemsFromFile("recyclable_items.txt", recyclableItems, recyclableIndex);
+        loadItemsFromFile("non_recyclable_items.txt", nonRecyclableItems, nonRecyclableIndex);
+    }
+
+    ~RecyclingSystem()
+    {
+        saveItemsToFile("recyclable_items.txt", recyclableItems);
+        saveItemsToFile("non_recyclable_items.txt", nonRecyclableItems);
+    }
+
+    // Add a recyclable item
     void addRecyclableItem(const string &itemName)
     {
         string lowerItemName = itemName;
@@ -119,13 +137,11 @@ public:
         }
 
         // Add the item to recyclable items
-        ItemNode *newItem = new ItemNode(lowerItemName);
-        newItem->next = recyclableHead;
-        recyclableHead = newItem;
+        addItem(recyclableItems, recyclableIndex, lowerItemName);
         cout << itemName << " added to recyclable items.\n";
     }
 
-    // Add a non-recyclable item to the linked list
+    // Add a non-recyclable item
     void addNonRecyclableItem(const string &itemName)
     {
         string lowerItemName = itemName;
@@ -139,71 +155,41 @@ public:
         }
 
         // Add the item to non-recyclable items
-        ItemNode *newItem = new ItemNode(lowerItemName);
-        newItem->next = nonRecyclableHead;
-        nonRecyclableHead = newItem;
+        addItem(nonRecyclableItems, nonRecyclableIndex, lowerItemName);
         cout << itemName << " added to non-recyclable items.\n";
     }
 
-    // Delete a recyclable item from the linked list
+    // Delete a recyclable item
     bool deleteRecyclableItem(const string &itemName)
     {
         string lowerItemName = itemName;
         toLowercase(lowerItemName); // Convert item name to lowercase before searching
 
-        ItemNode *current = recyclableHead;
-        ItemNode *previous = nullptr;
-
-        while (current)
+        if (deleteItem(recyclableItems, recyclableIndex, lowerItemName))
         {
-            if (current->name == lowerItemName)
-            {
-                if (previous)
-                    previous->next = current->next;
-                else
-                    recyclableHead = current->next;
-
-                delete current;
-                cout << itemName << " deleted from recyclable items.\n";
-                return true;
-            }
-            previous = current;
-            current = current->next;
+            cout << itemName << " deleted from recyclable items.\n";
+            return true;
         }
         cout << itemName << " not found in recyclable items.\n";
         return false;
     }
 
-    // Delete a non-recyclable item from the linked list
+    // Delete a non-recyclable item
     bool deleteNonRecyclableItem(const string &itemName)
     {
         string lowerItemName = itemName;
         toLowercase(lowerItemName); // Convert item name to lowercase before searching
 
-        ItemNode *current = nonRecyclableHead;
-        ItemNode *previous = nullptr;
-
-        while (current)
+        if (deleteItem(nonRecyclableItems, nonRecyclableIndex, lowerItemName))
         {
-            if (current->name == lowerItemName)
-            {
-                if (previous)
-                    previous->next = current->next;
-                else
-                    nonRecyclableHead = current->next;
-
-                delete current;
-                cout << itemName << " deleted from non-recyclable items.\n";
-                return true;
-            }
-            previous = current;
-            current = current->next;
+            cout << itemName << " deleted from non-recyclable items.\n";
+            return true;
         }
         cout << itemName << " not found in non-recyclable items.\n";
         return false;
     }
 
-    // Modify a recyclable item in the linked list
+    // Modify a recyclable item
     bool modifyRecyclableItem(const string &oldName, const string &newName)
     {
         string lowerOldName = oldName;
@@ -211,23 +197,16 @@ public:
         string lowerNewName = newName;
         toLowercase(lowerNewName); // Convert new name to lowercase before storing
 
-        ItemNode *current = recyclableHead;
-
-        while (current)
+        if (modifyItem(recyclableItems, recyclableIndex, lowerOldName, lowerNewName))
         {
-            if (current->name == lowerOldName)
-            {
-                current->name = lowerNewName;
-                cout << oldName << " modified to " << newName << " in recyclable items.\n";
-                return true;
-            }
-            current = current->next;
+            cout << oldName << " modified to " << newName << " in recyclable items.\n";
+            return true;
         }
         cout << oldName << " not found in recyclable items.\n";
         return false;
     }
 
-    // Modify a non-recyclable item in the linked list
+    // Modify a non-recyclable item
     bool modifyNonRecyclableItem(const string &oldName, const string &newName)
     {
         string lowerOldName = oldName;
@@ -235,17 +214,10 @@ public:
         string lowerNewName = newName;
         toLowercase(lowerNewName); // Convert new name to lowercase before storing
 
-        ItemNode *current = nonRecyclableHead;
-
-        while (current)
+        if (modifyItem(nonRecyclableItems, nonRecyclableIndex, lowerOldName, lowerNewName))
         {
-            if (current->name == lowerOldName)
-            {
-                current->name = lowerNewName;
-                cout << oldName << " modified to " << newName << " in non-recyclable items.\n";
-                return true;
-            }
-            current = current->next;
+            cout << oldName << " modified to " << newName << " in non-recyclable items.\n";
+            return true;
         }
         cout << oldName << " not found in non-recyclable items.\n";
         return false;
@@ -255,66 +227,42 @@ public:
     void displayRecyclableItems()
     {
         cout << "Recyclable Items:\n";
-        if (!recyclableHead)
+        if (recyclableItems.empty())
         {
             cout << "No recyclable items available.\n";
             return;
         }
-        ItemNode *current = recyclableHead;
-        while (current)
-        {
-            cout << "- " << current->name << "\n"; // Automatically in lowercase
-            current = current->next;
-        }
+        displayItems(recyclableItems);
     }
 
     // Display all non-recyclable items
     void displayNonRecyclableItems()
     {
         cout << "Non-Recyclable Items:\n";
-        if (!nonRecyclableHead)
+        if (nonRecyclableItems.empty())
         {
             cout << "No non-recyclable items available.\n";
             return;
         }
-        ItemNode *current = nonRecyclableHead;
-        while (current)
-        {
-            cout << "- " << current->name << "\n"; // Automatically in lowercase
-            current = current->next;
-        }
+        displayItems(nonRecyclableItems);
     }
 
-    // Brute force search: Check if an item is recyclable
+    // Check if an item is recyclable; returns its stored name or ""
     string isRecyclable(const string &itemName)
     {
         string lowerItemName = itemName;
         toLowercase(lowerItemName); // Convert item name to lowercase before searching
 
-        ItemNode *current = recyclableHead;
-        while (current)
-        {
-            if (current->name == lowerItemName) // Match found
-                return current->name;
-            current = current->next;
-        }
-        return ""; // No match
+        return recyclableIndex.contains(lowerItemName) ? lowerItemName : "";
     }
 
-    // Brute force search: Check if an item is non-recyclable
+    // Check if an item is non-recyclable; returns its stored name or ""
     string isNonRecyclable(const string &itemName)
     {
         string lowerItemName = itemName;
         toLowercase(lowerItemName); // Convert item name to lowercase before searching
 
-        ItemNode *current = nonRecyclableHead;
-        while (current)
-        {
-            if (current->name == lowerItemName) // Match found
-                return current->name;
-            current = current->next;
-        }
-        return ""; // No match
+        return nonRecyclableIndex.contains(lowerItemName) ? lowerItemName : "";
     }
 };
 
@@ -369,9 +317,91 @@ public:
     }
 };
 
+// --bench-items [max]: item classification lookups, linked list vs perfect hash,
+// for 10k entries up to max (default 1M) in steps of 10x
+void runItemLookupBenchmark(size_t maxEntries)
+{
+    struct ListNode // the old ItemNode list
+    {
+        string name;
+        ListNode *next;
+    };
+    typedef chrono::steady_clock Clock;
+    auto secondsSince = [](Clock::time_point start)
+    {
+        return chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    cout << "Item lookup benchmark (half hits, half misses)\n";
+    cout << left << setw(10) << "entries" << setw(28) << "linked list lookups/s" << setw(12) << "heap MB"
+         << setw(28) << "perfect hash lookups/s" << setw(12) << "heap MB" << "build s\n";
+    for (size_t n = 10000; n <= maxEntries; n *= 10)
+    {
+        vector<string> names(n);
+        for (size_t i = 0; i < n; i++)
+            names[i] = "item-" + to_string(i * 7919 % (n * 10));
+        vector<string> probes;
+        for (size_t i = 0; i < 1000; i++)
+            probes.push_back(i % 2 ? names[(i * 104729) % n] : "missing-" + to_string(i));
+        size_t hits = 0;
+
+        size_t heapBefore = heapBytesInUse();
+        ListNode *head = nullptr;
+        for (const string &name : names)
+            head = new ListNode{name, head};
+        double listMegabytes = (heapBytesInUse() - heapBefore) / 1048576.0;
+
+        size_t listLookups = max<size_t>(10, 20000000 / n);
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < listLookups; i++)
+        {
+            const string &probe = probes[i % probes.size()];
+            for (ListNode *current = head; current; current = current->next)
+            {
+                if (current->name == probe)
+                {
+                    hits++;
+                    break;
+                }
+            }
+        }
+        double listRate = listLookups / secondsSince(start);
+        while (head)
+        {
+            ListNode *next = head->next;
+            delete head;
+            head = next;
+        }
+
+        heapBefore = heapBytesInUse();
+        start = Clock::now();
+        PerfectHashSet index(names);
+        double buildSeconds = secondsSince(start);
+        double hashMegabytes = (heapBytesInUse() - heapBefore) / 1048576.0;
+
+        const size_t hashLookups = 2000000;
+        start = Clock::now();
+        for (size_t i = 0; i < hashLookups; i++)
+            hits += index.contains(probes[i % probes.size()]);
+        double hashRate = hashLookups / secondsSince(start);
+
+        cout << fixed << setprecision(0) << setw(10) << n << setw(28) << listRate << setprecision(1) << setw(12)
+             << listMegabytes << setprecision(0) << setw(28) << hashRate << setprecision(1) << setw(12)
+             << hashMegabytes << setprecision(2) << buildSeconds << "\n";
+        if (hits == 0)
+            cout << "(no hits)\n";
+    }
+}
+
 // Main Program
-int main()
+int main(int argc, char *argv[])
 {
+    if (argc > 1 && string(argv[1]) == "--bench-items")
+    {
+        runItemLookupBenchmark(argc > 2 ? stoull(argv[2]) : 1000000);
+        return 0;
+    }
+
     LoginSystem loginSystem;
     RecyclingSystem recyclingSystem;
 
@@ -6,6 +6,14 @@
 #include <map>
 #include <algorithm>
 #include <fstream>
+#include <cstdio>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include "Write_ahead_log.h"
+#include "Parallel_for.h"
 
 using namespace std;
 
@@ -18,106 +26,234 @@ struct WasteData {
     WasteData(string d, string l, double v) : date(d), location(l), volume(v) {}
 };
 
-// Trie node for location-based searching
-struct TrieNode {
-    map<char, TrieNode *> children;
-    bool isEndOfWord;
-    vector<WasteData *> locationData;
-
-    TrieNode() : isEndOfWord(false) {}
-};
-
 // Structure to store admin credentials (from your login system)
 struct Admin {
     string name;
     int password;
 };
 
-// Waste Volume Prediction System class
-class WastePredictionSystem {
-private:
-    vector<WasteData> historicalData;
-    TrieNode *locationTrie;
-    const int NUM_BUCKETS = 10;
+// Days since 1970-01-01 for a proleptic Gregorian date
+int daysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    int era = (year >= 0 ? year : year - 399) / 400;
+    int yearOfEra = year - era * 400;
+    int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
 
-    // Initialize Trie node
-    TrieNode *createNode() {
-        return new TrieNode();
-    }
+int daysInMonth(int year, int month) {
+    static const int lengths[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    return month == 2 && leap ? 29 : lengths[month - 1];
+}
 
-    // Insert location into Trie
-    void insertLocation(string location, WasteData *data) {
-        TrieNode *current = locationTrie;
+// Parses "DD-MM-YYYY" into a day number; false if the text is not a calendar date
+bool parseDate(const string &date, int &days) {
+    int day, month, year;
+    char extra;
+    if (sscanf(date.c_str(), "%d-%d-%d%c", &day, &month, &year, &extra) != 3)
+        return false;
+    if (month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month))
+        return false;
+    days = daysFromCivil(year, month, day);
+    return true;
+}
 
-        for (char c : location) {
-            if (current->children.find(c) == current->children.end()) {
-                current->children[c] = createNode();
-            }
-            current = current->children[c];
+string formatDate(int days) {
+    days += 719468;
+    int era = (days >= 0 ? days : days - 146096) / 146097;
+    int dayOfEra = days - era * 146097;
+    int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int mp = (5 * dayOfYear + 2) / 153;
+    int day = dayOfYear - (153 * mp + 2) / 5 + 1;
+    int month = mp + (mp < 10 ? 3 : -9);
+    int year = yearOfEra + era * 400 + (month <= 2);
+
+    char text[32];
+    snprintf(text, sizeof(text), "%02d-%02d-%04d", day, month, year);
+    return text;
+}
+
+// Forecast model for one location, kept current on every insert so a forecast
+// never has to look at the history again.
+//  - least-squares line through (day - firstDay, volume) from running sums
+//  - Holt's linear exponential smoothing (EWMA of level and trend), one step per observation
+struct ForecastState {
+    static constexpr double ALPHA = 0.5; // level smoothing
+    static constexpr double BETA = 0.3;  // trend smoothing
+
+    double count = 0, sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+    double level = 0, trend = 0;
+
+    void smooth(double volume) {
+        if (count == 1) {
+            level = volume;
+            trend = 0;
+        } else if (count == 2) {
+            trend = volume - level;
+            level = volume;
+        } else {
+            double previous = level;
+            level = ALPHA * volume + (1 - ALPHA) * (level + trend);
+            trend = BETA * (level - previous) + (1 - BETA) * trend;
         }
+    }
 
-        current->isEndOfWord = true;
-        current->locationData.push_back(data);
+    void add(double x, double volume) {
+        count++;
+        sumX += x;
+        sumY += volume;
+        sumXX += x * x;
+        sumXY += x * volume;
+        smooth(volume);
     }
+};
 
-    // Bucket Sort implementation
-    void bucketSort(vector<WasteData> &data) {
-        if (data.empty())
+// Columnar history of one location: parallel day/volume arrays kept in date order
+struct LocationSeries {
+    vector<int> days;
+    vector<double> volumes;
+    ForecastState state;
+
+    // Full recomputation, needed only when a reading arrives out of date order.
+    // Four independent accumulators let the compiler keep the sums in vector lanes.
+    void rebuildState() {
+        state = ForecastState();
+        size_t n = volumes.size();
+        if (n == 0)
             return;
 
-        vector<vector<WasteData>> buckets(NUM_BUCKETS);
-
-        // Find range of volumes
-        double maxVol = data[0].volume;
-        double minVol = data[0].volume;
-        for (const auto &entry : data) {
-            maxVol = max(maxVol, entry.volume);
-            minVol = min(minVol, entry.volume);
+        const int origin = days[0];
+        double sx[4] = {0, 0, 0, 0}, sy[4] = {0, 0, 0, 0}, sxx[4] = {0, 0, 0, 0}, sxy[4] = {0, 0, 0, 0};
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            for (int lane = 0; lane < 4; lane++) {
+                double x = days[i + lane] - origin, y = volumes[i + lane];
+                sx[lane] += x;
+                sy[lane] += y;
+                sxx[lane] += x * x;
+                sxy[lane] += x * y;
+            }
+        }
+        for (; i < n; i++) {
+            double x = days[i] - origin, y = volumes[i];
+            sx[0] += x;
+            sy[0] += y;
+            sxx[0] += x * x;
+            sxy[0] += x * y;
+        }
+        state.sumX = sx[0] + sx[1] + sx[2] + sx[3];
+        state.sumY = sy[0] + sy[1] + sy[2] + sy[3];
+        state.sumXX = sxx[0] + sxx[1] + sxx[2] + sxx[3];
+        state.sumXY = sxy[0] + sxy[1] + sxy[2] + sxy[3];
+
+        for (size_t k = 0; k < n; k++) {
+            state.count = k + 1;
+            state.smooth(volumes[k]);
         }
+    }
 
-        if (maxVol == minVol) {
-            // All volumes are the same; no need to sort
+    void add(int day, double volume) {
+        if (days.empty() || day >= days.back()) {
+            days.push_back(day);
+            volumes.push_back(volume);
+            state.add(day - days[0], volume);
             return;
         }
+        size_t at = upper_bound(days.begin(), days.end(), day) - days.begin();
+        days.insert(days.begin() + at, day);
+        volumes.insert(volumes.begin() + at, volume);
+        rebuildState();
+    }
 
-        // Distribute into buckets
-        for (const auto &entry : data) {
-            int bucketIndex = (int)((entry.volume - minVol) * NUM_BUCKETS / (maxVol - minVol + 1));
-            bucketIndex = min(bucketIndex, NUM_BUCKETS - 1);
-            buckets[bucketIndex].push_back(entry);
+    // Volumes for the next `steps` observation intervals (average spacing so far):
+    // the mean of the regression line and the Holt projection, never negative.
+    void forecast(int steps, double *out) const {
+        double n = state.count;
+        double spacing = n > 1 ? double(days.back() - days[0]) / (n - 1) : 30;
+        double denominator = n * state.sumXX - state.sumX * state.sumX;
+        double slope = denominator > 1e-9 ? (n * state.sumXY - state.sumX * state.sumY) / denominator : 0;
+        double intercept = (state.sumY - slope * state.sumX) / n;
+        double lastX = days.back() - days[0];
+
+        for (int h = 1; h <= steps; h++) {
+            double regression = intercept + slope * (lastX + h * spacing);
+            double smoothed = state.level + h * state.trend;
+            out[h - 1] = max(0.0, (regression + smoothed) / 2);
         }
+    }
+};
 
-        // Sort individual buckets
-        for (auto &bucket : buckets) {
-            sort(bucket.begin(), bucket.end(),
-                 [](const WasteData &a, const WasteData &b) {
-                     return a.volume < b.volume;
-                 });
-        }
+// Waste Volume Prediction System class
+class WastePredictionSystem {
+private:
+    // Stable location dictionary: id -> name and name -> id; series[id] is its history
+    vector<string> locationNames;
+    unordered_map<string, int> locationIds;
+    vector<LocationSeries> series;
+    long long nextRecordKey; // history is append-only, keyed by insertion sequence
+    WalStore store;
+
+    string encodeWasteData(const WasteData &data) const {
+        return RecordWriter().putString(data.date).putString(data.location).putDouble(data.volume).str();
+    }
 
-        // Concatenate all buckets
-        data.clear();
-        for (const auto &bucket : buckets) {
-            data.insert(data.end(), bucket.begin(), bucket.end());
-        }
+    int internLocation(const string &location) {
+        auto found = locationIds.find(location);
+        if (found != locationIds.end())
+            return found->second;
+        locationIds[location] = locationNames.size();
+        locationNames.push_back(location);
+        series.emplace_back();
+        return locationNames.size() - 1;
     }
 
-    void saveWasteDataToFile() {
-        ofstream outFile("waste_data.txt");
-        if (outFile.is_open()) {
-            for (const auto &data : historicalData) {
-                outFile << data.date << "," << data.location << "," << data.volume << "\n";
+    bool insertReading(const string &date, const string &location, double volume) {
+        int day;
+        if (!parseDate(date, day))
+            return false;
+        series[internLocation(location)].add(day, volume);
+        return true;
+    }
+
+    // Snapshot keys are renumbered from 0, but nextRecordKey is left alone: if
+    // the compaction fails, the old log still holds keys up to it
+    void saveWasteDataToFile(WalStore::SnapshotWriter &out) const {
+        long long key = 0;
+        for (size_t id = 0; id < series.size(); id++) {
+            for (size_t i = 0; i < series[id].days.size(); i++) {
+                WasteData data(formatDate(series[id].days[i]), locationNames[id], series[id].volumes[i]);
+                out.put(walKey(key++), encodeWasteData(data));
             }
-            outFile.close();
-        } else {
-            cerr << "Unable to open file for saving waste data.\n";
         }
     }
 
     void loadWasteDataFromFile() {
+        vector<pair<string, string>> records;
+        if (!store.open(records)) {
+            importWasteDataFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records) {
+            RecordReader in(record.second);
+            string date = in.getString();
+            string location = in.getString();
+            double volume = in.getDouble();
+            insertReading(date, location, volume);
+            nextRecordKey = max(nextRecordKey, stoll(record.first) + 1);
+        }
+    }
+
+    // One-time migration from the old comma-separated waste_data.txt
+    void importWasteDataFromTextFile() {
         ifstream inFile("waste_data.txt");
         if (inFile.is_open()) {
             string line;
+            int skipped = 0;
             while (getline(inFile, line)) {
                 size_t pos1 = line.find(',');
                 size_t pos2 = line.find(',', pos1 + 1);
@@ -125,93 +261,91 @@ private:
                 string location = line.substr(pos1 + 1, pos2 - pos1 - 1);
                 double volume = stod(line.substr(pos2 + 1));
 
-                WasteData newData(date, location, volume);
-                historicalData.push_back(newData);
-                insertLocation(location, &historicalData.back());
+                if (insertReading(date, location, volume))
+                    nextRecordKey++;
+                else
+                    skipped++;
             }
             inFile.close();
+            if (skipped > 0)
+                cerr << "Skipped " << skipped << " waste data rows with unreadable dates.\n";
         } else {
             cerr << "Unable to open file for loading waste data.\n";
         }
     }
 
 public:
-    WastePredictionSystem() {
-        locationTrie = createNode();
+    static const int FORECAST_MONTHS = 3;
+
+    WastePredictionSystem()
+        : nextRecordKey(0), store("waste_data", [this](WalStore::SnapshotWriter &out) { saveWasteDataToFile(out); }) {
         loadWasteDataFromFile();
     }
 
-    ~WastePredictionSystem() {
-        saveWasteDataToFile();
+    // Add new waste data; false if the date is not a valid DD-MM-YYYY date
+    bool addWasteData(string date, string location, double volume) {
+        if (!insertReading(date, location, volume))
+            return false;
+        store.put(walKey(nextRecordKey++), encodeWasteData(WasteData(date, location, volume)));
+        return true;
     }
 
-    // Add new waste data
-    void addWasteData(string date, string location, double volume) {
-        WasteData newData(date, location, volume);
-        historicalData.push_back(newData);
-        insertLocation(location, &historicalData.back());
-        saveWasteDataToFile();
+    int locationCount() const {
+        return locationNames.size();
+    }
+
+    const string &locationName(int id) const {
+        return locationNames[id];
     }
 
     // Generate prediction for a location
     vector<double> predictWasteVolume(string location) {
         vector<double> predictions;
-        TrieNode *current = locationTrie;
-
-        // Find location in Trie
-        for (char c : location) {
-            if (current->children.find(c) == current->children.end()) {
-                cout << "No data available for this location.\n";
-                return predictions;
-            }
-            current = current->children[c];
-        }
-
-        if (!current->isEndOfWord) {
-            cout << "Location not found.\n";
+        auto found = locationIds.find(location);
+        if (found == locationIds.end()) {
+            cout << "No data available for this location.\n";
             return predictions;
         }
 
-        // Access location history
-        vector<WasteData *> &locationHistory = current->locationData;
-        if (locationHistory.empty()) {
-            cout << "No historical data for the location.\n";
-            return predictions;
-        }
-
-        // Sort historical data
-        vector<WasteData> sortedData;
-        for (auto *data : locationHistory) {
-            if (data) {
-                sortedData.push_back(*data);
-            }
-        }
-
-        if (sortedData.empty()) {
-            cout << "Error: No valid historical data found.\n";
-            return predictions;
-        }
+        predictions.resize(FORECAST_MONTHS);
+        series[found->second].forecast(FORECAST_MONTHS, predictions.data());
+        return predictions;
+    }
 
-        bucketSort(sortedData);
+    // Forecasts for every location in one parallel pass. Row id of the result
+    // (months values each) belongs to locationName(id).
+    vector<double> forecastAllLocations(int months = FORECAST_MONTHS, unsigned threadCount = 0) const {
+        const int chunkSize = 1024;
+        int count = series.size();
+        vector<double> forecasts((size_t)count * months);
+        parallelFor((count + chunkSize - 1) / chunkSize, [&](int chunk) {
+            int end = min(count, (chunk + 1) * chunkSize);
+            for (int id = chunk * chunkSize; id < end; id++)
+                series[id].forecast(months, forecasts.data() + (size_t)id * months);
+        }, threadCount);
+        return forecasts;
+    }
 
-        // Calculate predictions for the next 3 months
-        double avgVolume = 0;
-        for (const auto &data : sortedData) {
-            avgVolume += data.volume;
-        }
-        avgVolume /= sortedData.size();
+    // Citywide forecast written as CSV: location,month1,month2,month3
+    void exportCitywideForecast(const string &fileName) const {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        vector<double> forecasts = forecastAllLocations();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
 
-        // Linear trend prediction
-        double trend = 0;
-        if (sortedData.size() > 1) {
-            trend = (sortedData.back().volume - sortedData.front().volume) / (sortedData.size() - 1);
+        ofstream outFile(fileName);
+        if (!outFile.is_open()) {
+            cerr << "Unable to open " << fileName << " for writing.\n";
+            return;
         }
-
-        for (int i = 1; i <= 3; ++i) {
-            predictions.push_back(max(0.0, avgVolume + trend * i)); // Ensure non-negative predictions
+        outFile << fixed << setprecision(2);
+        for (int id = 0; id < locationCount(); id++) {
+            outFile << locationNames[id];
+            for (int m = 0; m < FORECAST_MONTHS; m++)
+                outFile << "," << forecasts[(size_t)id * FORECAST_MONTHS + m];
+            outFile << "\n";
         }
-
-        return predictions;
+        cout << "Forecast for " << locationCount() << " locations written to " << fileName << " ("
+             << fixed << setprecision(3) << seconds * 1000 << " ms).\n";
     }
 
     // Generate forecast report
@@ -225,7 +359,7 @@ public:
         cout << "----------------------------------------\n";
         cout << "Predictions for the next 3 months:\n\n";
 
-        for (int i = 0; i < predictions.size(); i++) {
+        for (int i = 0; i < (int)predictions.size(); i++) {
             cout << "Month " << (i + 1) << ": " << fixed << setprecision(2)
                  << predictions[i] << " tons\n";
         }
@@ -278,7 +412,8 @@ public:
             cout << "\nAdmin Dashboard\n";
             cout << "1. Add New Waste Data\n";
             cout << "2. Generate Forecast Report\n";
-            cout << "3. Logout\n";
+            cout << "3. Export Citywide Forecast\n";
+            cout << "4. Logout\n";
             cout << "Enter choice: ";
 
             int choice;
@@ -297,8 +432,11 @@ public:
                 cout << "Enter waste volume (tons): ";
                 cin >> volume;
 
-                predictionSystem.addWasteData(date, location, volume);
-                cout << "Data added successfully!\n";
+                if (predictionSystem.addWasteData(date, location, volume)) {
+                    cout << "Data added successfully!\n";
+                } else {
+                    cout << "Invalid date. Use a real DD-MM-YYYY date.\n";
+                }
                 break;
             }
             case 2: {
@@ -310,6 +448,9 @@ public:
                 break;
             }
             case 3:
+                predictionSystem.exportCitywideForecast("citywide_forecast.csv");
+                break;
+            case 4:
                 return;
             default:
                 cout << "Invalid choice!\n";
@@ -350,7 +491,67 @@ public:
     }
 };
 
-int main() {
+// --bench-forecast: nightly citywide run over synthetic monthly history
+void runForecastBenchmark() {
+    typedef chrono::steady_clock Clock;
+    auto secondsSince = [](Clock::time_point start) {
+        return chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    const int locationCount = 20000;
+    const int monthsOfHistory = 120;
+    const int months = WastePredictionSystem::FORECAST_MONTHS;
+
+    srand(17);
+    vector<LocationSeries> series(locationCount);
+    Clock::time_point start = Clock::now();
+    for (int month = 0; month < monthsOfHistory; month++) {
+        int day = daysFromCivil(2015 + month / 12, month % 12 + 1, 1);
+        for (int id = 0; id < locationCount; id++) {
+            double base = 20 + id % 50;
+            series[id].add(day, base + 0.1 * month + (rand() % 100) / 25.0);
+        }
+    }
+    double ingestSeconds = secondsSince(start);
+
+    // Old shape of the work: revisit every location's whole history per forecast
+    vector<double> rescanned((size_t)locationCount * months);
+    start = Clock::now();
+    for (int id = 0; id < locationCount; id++) {
+        LocationSeries copy = series[id];
+        copy.rebuildState();
+        copy.forecast(months, rescanned.data() + (size_t)id * months);
+    }
+    double rescanSeconds = secondsSince(start);
+
+    vector<double> forecasts((size_t)locationCount * months);
+    start = Clock::now();
+    parallelFor((locationCount + 1023) / 1024, [&](int chunk) {
+        int end = min(locationCount, (chunk + 1) * 1024);
+        for (int id = chunk * 1024; id < end; id++)
+            series[id].forecast(months, forecasts.data() + (size_t)id * months);
+    });
+    double batchSeconds = secondsSince(start);
+
+    double maxDifference = 0;
+    for (size_t i = 0; i < forecasts.size(); i++)
+        maxDifference = max(maxDifference, fabs(forecasts[i] - rescanned[i]));
+
+    cout << fixed << setprecision(3);
+    cout << "Forecast benchmark (" << locationCount << " locations x " << monthsOfHistory << " months)\n";
+    cout << "  incremental ingest:        " << ingestSeconds * 1e9 / ((double)locationCount * monthsOfHistory)
+         << " ns/reading\n";
+    cout << "  rescan history per location: " << rescanSeconds * 1000 << " ms\n";
+    cout << "  incremental batch forecast:  " << batchSeconds * 1000 << " ms\n";
+    cout << "  max difference:              " << setprecision(9) << maxDifference << "\n";
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && string(argv[1]) == "--bench-forecast") {
+        runForecastBenchmark();
+        return 0;
+    }
+
     LoginSystem loginSystem;
     while (true) {
         cout << "\nLogin Page\n";
@@ -0,0 +1,502 @@
+// Write_ahead_log.h
+// Shared persistence layer: an append-only, checksummed binary log per store plus
+// periodic compacted snapshots. Mutations cost one small append instead of a full
+// file rewrite; startup maps the snapshot and replays only the log tail.
+//
+//   <name>.snap  "SCSNP001" | count | (key, value)* | crc32 of the entries
+//   <name>.wal   "SCWAL001" | (length | crc32 | op | key | value)*
+//
+// The owning module keeps its own in-memory state. It replays records through a
+// callback on open and writes its live state back out when the log is compacted.
+#ifndef WRITE_AHEAD_LOG_H
+#define WRITE_AHEAD_LOG_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <filesystem>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+struct Crc32Table {
+    uint32_t entries[256];
+
+    Crc32Table() {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            entries[i] = c;
+        }
+    }
+};
+
+inline uint32_t crc32Update(uint32_t crc, const char *data, size_t length) {
+    // Function-local static: built once, and thread-safe on first use from any store
+    static const Crc32Table table;
+
+    crc = ~crc;
+    for (size_t i = 0; i < length; ++i)
+        crc = table.entries[(crc ^ (unsigned char)data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+// Forces a file, or a directory's entries, out to stable storage
+inline bool syncToDisk(const std::string &path, bool directory) {
+#ifdef _WIN32
+    if (directory)
+        return true; // NTFS journals the rename itself; directories cannot be flushed
+    int fd = _open(path.c_str(), _O_RDWR | _O_BINARY);
+    if (fd < 0)
+        return false;
+    bool synced = _commit(fd) == 0;
+    _close(fd);
+    return synced;
+#else
+    int fd = ::open(path.c_str(), directory ? O_RDONLY : O_RDWR);
+    if (fd < 0)
+        return false;
+    bool synced = fsync(fd) == 0;
+    ::close(fd);
+    return synced;
+#endif
+}
+
+// Little binary encoder for record values
+class RecordWriter {
+private:
+    std::string bytes;
+
+public:
+    RecordWriter &putInt(long long value) {
+        bytes.append((const char *)&value, sizeof(value));
+        return *this;
+    }
+
+    RecordWriter &putDouble(double value) {
+        bytes.append((const char *)&value, sizeof(value));
+        return *this;
+    }
+
+    RecordWriter &putString(const std::string &value) {
+        uint32_t length = value.size();
+        bytes.append((const char *)&length, sizeof(length));
+        bytes.append(value);
+        return *this;
+    }
+
+    const std::string &str() const {
+        return bytes;
+    }
+};
+
+// Decoder matching RecordWriter; reads past the end yield zero values
+class RecordReader {
+private:
+    const char *data;
+    size_t length;
+    size_t pos;
+
+    bool take(void *out, size_t size) {
+        if (pos + size > length) {
+            memset(out, 0, size);
+            pos = length;
+            return false;
+        }
+        memcpy(out, data + pos, size);
+        pos += size;
+        return true;
+    }
+
+public:
+    explicit RecordReader(const std::string &value) : data(value.data()), length(value.size()), pos(0) {}
+
+    long long getInt() {
+        long long value;
+        take(&value, sizeof(value));
+        return value;
+    }
+
+    double getDouble() {
+        double value;
+        take(&value, sizeof(value));
+        return value;
+    }
+
+    std::string getString() {
+        uint32_t size;
+        if (!take(&size, sizeof(size)) || pos + size > length)
+            return "";
+        std::string value(data + pos, size);
+        pos += size;
+        return value;
+    }
+};
+
+// Read-only view of a whole file; mmap where available
+class MappedFile {
+private:
+    const char *bytes;
+    size_t length;
+    std::vector<char> fallback;
+#ifndef _WIN32
+    void *mapping;
+#endif
+
+public:
+    explicit MappedFile(const std::string &path) : bytes(nullptr), length(0) {
+#ifndef _WIN32
+        mapping = MAP_FAILED;
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                bytes = (const char *)mapping;
+                length = info.st_size;
+            }
+        }
+        ::close(fd);
+        if (bytes)
+            return;
+#endif
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open())
+            return;
+        fallback.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        bytes = fallback.data();
+        length = fallback.size();
+    }
+
+    ~MappedFile() {
+#ifndef _WIN32
+        if (mapping != MAP_FAILED)
+            munmap(mapping, length);
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const char *data() const { return bytes; }
+    size_t size() const { return length; }
+};
+
+class WalStore {
+public:
+    enum Op {
+        PUT = 1,
+        ERASE = 2,
+        CLEAR = 3
+    };
+
+    // Receives replayed records on open (snapshot entries arrive as PUT)
+    typedef std::function<void(Op op, const std::string &key, const std::string &value)> ReplayFn;
+
+    // Streams the owner's live state into a new snapshot
+    class SnapshotWriter {
+    private:
+        std::ofstream &out;
+        uint32_t crc;
+        uint64_t count;
+
+        void write(const char *data, size_t length) {
+            out.write(data, length);
+            crc = crc32Update(crc, data, length);
+        }
+
+        friend class WalStore;
+        explicit SnapshotWriter(std::ofstream &out) : out(out), crc(0), count(0) {}
+
+    public:
+        void put(const std::string &key, const std::string &value) {
+            uint32_t keyLength = key.size(), valueLength = value.size();
+            write((const char *)&keyLength, sizeof(keyLength));
+            write(key.data(), keyLength);
+            write((const char *)&valueLength, sizeof(valueLength));
+            write(value.data(), valueLength);
+            count++;
+        }
+    };
+    typedef std::function<void(SnapshotWriter &out)> SnapshotFn;
+
+private:
+    std::string snapshotPath;
+    std::string logPath;
+    SnapshotFn snapshotter;
+    size_t compactBytes;
+    size_t compactAt; // log size that triggers the next compaction
+    FILE *log;
+    size_t logBytes;
+
+    static constexpr const char *LOG_MAGIC = "SCWAL001";
+    static constexpr const char *SNAP_MAGIC = "SCSNP001";
+    static const size_t MAGIC_SIZE = 8;
+
+    void openLogForAppend(bool fresh) {
+        if (log)
+            fclose(log);
+        log = fopen(logPath.c_str(), fresh ? "wb" : "ab");
+        if (!log) {
+            std::cerr << "Unable to open " << logPath << " for writing.\n";
+            return;
+        }
+        if (fresh) {
+            fwrite(LOG_MAGIC, 1, MAGIC_SIZE, log);
+            fflush(log);
+            logBytes = MAGIC_SIZE;
+        }
+    }
+
+    bool replaySnapshot(const ReplayFn &replay) {
+        MappedFile file(snapshotPath);
+        const char *p = file.data();
+        size_t size = file.size();
+        if (!p || size < MAGIC_SIZE + sizeof(uint64_t) + sizeof(uint32_t) || memcmp(p, SNAP_MAGIC, MAGIC_SIZE) != 0)
+            return false;
+
+        size_t entriesStart = MAGIC_SIZE + sizeof(uint64_t);
+        size_t bodyEnd = size - sizeof(uint32_t);
+        uint32_t storedCrc;
+        memcpy(&storedCrc, p + bodyEnd, sizeof(storedCrc));
+        if (crc32Update(0, p + entriesStart, bodyEnd - entriesStart) != storedCrc) {
+            std::cerr << "Snapshot " << snapshotPath << " is corrupt; ignoring it.\n";
+            return false;
+        }
+
+        uint64_t count;
+        memcpy(&count, p + MAGIC_SIZE, sizeof(count));
+        size_t pos = entriesStart;
+        std::string key, value;
+        for (uint64_t i = 0; i < count && pos < bodyEnd; ++i) {
+            uint32_t length;
+            memcpy(&length, p + pos, sizeof(length));
+            pos += sizeof(length);
+            key.assign(p + pos, length);
+            pos += length;
+            memcpy(&length, p + pos, sizeof(length));
+            pos += sizeof(length);
+            value.assign(p + pos, length);
+            pos += length;
+            replay(PUT, key, value);
+        }
+        return true;
+    }
+
+    // Replays intact records; a torn or corrupt tail is cut off
+    bool replayLog(const ReplayFn &replay) {
+        size_t goodEnd = 0;
+        {
+            MappedFile file(logPath);
+            const char *p = file.data();
+            size_t size = file.size();
+            if (!p || size < MAGIC_SIZE || memcmp(p, LOG_MAGIC, MAGIC_SIZE) != 0)
+                return false;
+
+            size_t pos = MAGIC_SIZE;
+            std::string key, value;
+            while (pos + 2 * sizeof(uint32_t) <= size) {
+                uint32_t length, crc;
+                memcpy(&length, p + pos, sizeof(length));
+                memcpy(&crc, p + pos + sizeof(length), sizeof(crc));
+                const char *payload = p + pos + 2 * sizeof(uint32_t);
+                if (length < 1 + sizeof(uint32_t) || length > size - pos - 2 * sizeof(uint32_t) ||
+                    crc32Update(0, payload, length) != crc)
+                    break;
+
+                uint32_t keyLength;
+                memcpy(&keyLength, payload + 1, sizeof(keyLength));
+                if (1 + sizeof(uint32_t) + keyLength > length)
+                    break;
+                key.assign(payload + 1 + sizeof(uint32_t), keyLength);
+                value.assign(payload + 1 + sizeof(uint32_t) + keyLength, length - 1 - sizeof(uint32_t) - keyLength);
+                replay((Op)payload[0], key, value);
+                pos += 2 * sizeof(uint32_t) + length;
+            }
+            goodEnd = pos;
+            if (goodEnd < size)
+                std::cerr << "Discarding " << size - goodEnd << " bytes of incomplete log tail in " << logPath << ".\n";
+        }
+
+        std::error_code ignored;
+        if (std::filesystem::file_size(logPath, ignored) > goodEnd)
+            std::filesystem::resize_file(logPath, goodEnd, ignored);
+        logBytes = goodEnd;
+        return true;
+    }
+
+    void append(Op op, const std::string &key, const std::string &value) {
+        if (!log)
+            return;
+        uint32_t keyLength = key.size();
+        std::string payload;
+        payload.reserve(1 + sizeof(keyLength) + key.size() + value.size());
+        payload.push_back((char)op);
+        payload.append((const char *)&keyLength, sizeof(keyLength));
+        payload.append(key);
+        payload.append(value);
+
+        uint32_t length = payload.size();
+        uint32_t crc = crc32Update(0, payload.data(), payload.size());
+        fwrite(&length, sizeof(length), 1, log);
+        fwrite(&crc, sizeof(crc), 1, log);
+        fwrite(payload.data(), 1, payload.size(), log);
+        fflush(log);
+        logBytes += 2 * sizeof(uint32_t) + payload.size();
+
+        if (logBytes > compactAt)
+            compact();
+    }
+
+public:
+    WalStore(const std::string &name, SnapshotFn snapshotter, size_t compactBytes = 8u << 20)
+        : snapshotPath(name + ".snap"), logPath(name + ".wal"), snapshotter(snapshotter),
+          compactBytes(compactBytes), compactAt(compactBytes), log(nullptr), logBytes(0) {}
+
+    ~WalStore() {
+        if (log)
+            fclose(log);
+    }
+
+    WalStore(const WalStore &) = delete;
+    WalStore &operator=(const WalStore &) = delete;
+
+    // Loads the snapshot and replays the log tail. Returns false when nothing was
+    // persisted yet, so the caller can import its legacy text file and compact().
+    bool open(const ReplayFn &replay) {
+        bool hadSnapshot = replaySnapshot(replay);
+        bool hadLog = replayLog(replay);
+        openLogForAppend(!hadLog);
+        return hadSnapshot || hadLog;
+    }
+
+    // Same as above, collected into live (key, value) records in first-write order
+    bool open(std::vector<std::pair<std::string, std::string>> &records) {
+        std::unordered_map<std::string, size_t> position;
+        std::vector<char> erased;
+        bool existed = open([&](Op op, const std::string &key, const std::string &value) {
+            if (op == CLEAR) {
+                records.clear();
+                position.clear();
+                erased.clear();
+                return;
+            }
+            auto found = position.find(key);
+            if (op == ERASE) {
+                if (found != position.end()) {
+                    erased[found->second] = 1;
+                    position.erase(found);
+                }
+                return;
+            }
+            if (found != position.end()) {
+                records[found->second].second = value;
+            } else {
+                position[key] = records.size();
+                records.push_back(std::make_pair(key, value));
+                erased.push_back(0);
+            }
+        });
+
+        size_t kept = 0;
+        for (size_t i = 0; i < records.size(); ++i) {
+            if (!erased[i])
+                records[kept++].swap(records[i]);
+        }
+        records.resize(kept);
+        return existed;
+    }
+
+    void put(const std::string &key, const std::string &value) {
+        append(PUT, key, value);
+    }
+
+    void erase(const std::string &key) {
+        append(ERASE, key, "");
+    }
+
+    void clear() {
+        append(CLEAR, "", "");
+    }
+
+    // Writes the owner's live state to a fresh snapshot and starts an empty log.
+    // The log is only truncated once the new snapshot is durable (written, synced
+    // and renamed into place); if any step fails the old snapshot and the full log
+    // stay as they are, appends continue, and compaction is retried later.
+    bool compact() {
+        std::string tempPath = snapshotPath + ".tmp";
+        std::error_code ignored;
+        bool written = false;
+        {
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            if (out.is_open()) {
+                out.write(SNAP_MAGIC, MAGIC_SIZE);
+                uint64_t placeholder = 0;
+                out.write((const char *)&placeholder, sizeof(placeholder));
+
+                SnapshotWriter writer(out);
+                snapshotter(writer);
+                uint32_t crc = writer.crc;
+                out.write((const char *)&crc, sizeof(crc));
+
+                out.seekp(MAGIC_SIZE);
+                out.write((const char *)&writer.count, sizeof(writer.count));
+                out.close();
+                written = !out.fail();
+            }
+        }
+
+        // rename() replaces the old snapshot in one step, so there is always one on disk
+        bool replaced = written && syncToDisk(tempPath, false);
+        if (replaced) {
+            std::filesystem::rename(tempPath, snapshotPath, ignored);
+            replaced = !ignored;
+        }
+        if (!replaced) {
+            std::cerr << "Unable to write snapshot " << snapshotPath << "; keeping the log.\n";
+            std::filesystem::remove(tempPath, ignored);
+            compactAt = logBytes + compactBytes;
+            return false;
+        }
+        std::string directory = std::filesystem::path(snapshotPath).parent_path().string();
+        if (!syncToDisk(directory.empty() ? "." : directory, true)) {
+            std::cerr << "Unable to sync the directory of " << snapshotPath << "; keeping the log.\n";
+            compactAt = logBytes + compactBytes;
+            return false;
+        }
+
+        openLogForAppend(true);
+        compactAt = compactBytes;
+        return true;
+    }
+
+    size_t logSize() const {
+        return logBytes;
+    }
+};
+
+// Fixed-width key so lexical order matches numeric order
+inline std::string walKey(long long id) {
+    char buffer[24];
+    snprintf(buffer, sizeof(buffer), "%020lld", id);
+    return buffer;
+}
+
+#endif
@@ -0,0 +1,366 @@
+// smartcity/Batch_commands.h
+// Scripted mode (--batch <file>): runs a command file against the module APIs
+// without any menus, one command per line. Words are separated by spaces,
+// "double quotes" keep spaces inside one argument and # starts a comment.
+//
+//   route.add-point <name>                     route.add-route <from> <to> <km>
+//   route.shortest <from> <to>                 route.plan <depot> <capacity> <trucks>
+//   bins.add <id> <location>                   bins.fill <id> <level>
+//   bins.move <id> <location>                  bins.remove <id>
+//   market.add <category> <name> <price>       market.search <category>
+//   forecast.add <DD-MM-YYYY> <location> <volume>
+//   forecast.predict <location>
+//   hazardous.enqueue <name> <category> [risk] hazardous.queue
+//   complaint.submit <citizen> <area> <text>   complaint.classify <text>
+//   carbon.cities <city>...                    carbon.add-route <from> <to> <km> <type>
+//   food.add <donor> <location> <food> <quantity> <status>
+//   food.search <location>                     plastic.add <source> <kg> <status>
+//   metrics.reset                              metrics.write <file.json>
+//   echo <text>...
+//
+// Every command is also counted and timed under "batch.<command>".
+#ifndef SMARTCITY_BATCH_COMMANDS_H
+#define SMARTCITY_BATCH_COMMANDS_H
+
+#include <cctype>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Bin_monitoring.h"
+#include "Carbon_footprint.h"
+#include "Complaints.h"
+#include "Food_waste.h"
+#include "Hazardous.h"
+#include "Instrumentation.h"
+#include "Marketplace.h"
+#include "Plastic_tracking.h"
+#include "Routing.h"
+#include "Volume_prediction.h"
+
+// The modules a batch run drives; they are owned by main
+struct SmartCityModules
+{
+    Graph &cityGraph;
+    Bin_Monitoring_System &bins;
+    Recycled_Product_Marketplace &marketplace;
+    WastePredictionSystem &prediction;
+    Hazardous_System &hazardous;
+    ComplaintSystem &complaints;
+    ComplaintPriority &priorities;
+    Carbon_Footprint &carbon;
+    FoodWasteManagementSystem &food;
+    WasteTrackingSystem &plastic;
+};
+
+class BatchRunner
+{
+private:
+    typedef std::vector<std::string> Args;
+
+    struct Command
+    {
+        std::string usage;
+        size_t minArgs;
+        size_t maxArgs;
+        std::function<bool(const Args &)> run; // false if the command failed
+    };
+
+    SmartCityModules modules;
+    std::map<std::string, Command> commands;
+
+    static const size_t ANY = (size_t)-1;
+
+    void add(const std::string &name, const std::string &usage, size_t minArgs, size_t maxArgs, std::function<bool(const Args &)> run)
+    {
+        commands[name] = {usage, minArgs, maxArgs, run};
+    }
+
+    static std::string joined(const Args &args, size_t first)
+    {
+        std::string text;
+        for (size_t i = first; i < args.size(); i++)
+            text += (i > first ? " " : "") + args[i];
+        return text;
+    }
+
+    bool fail(const std::string &message)
+    {
+        std::cout << message << "\n";
+        return false;
+    }
+
+    void registerCommands()
+    {
+        SmartCityModules &m = modules;
+
+        add("route.add-point", "<name>", 1, 1, [&m](const Args &a)
+        {
+            return m.cityGraph.getNodeIndex(a[0]) == -1 && m.cityGraph.addNode(a[0]);
+        });
+        add("route.add-route", "<from> <to> <km>", 3, 3, [&m](const Args &a)
+        {
+            return m.cityGraph.addEdge(a[0], a[1], std::stof(a[2]));
+        });
+        add("route.shortest", "<from> <to>", 2, 2, [this, &m](const Args &a)
+        {
+            int from = m.cityGraph.getNodeIndex(a[0]), to = m.cityGraph.getNodeIndex(a[1]);
+            if (from == -1 || to == -1)
+                return fail("Unknown collection point.");
+            std::shared_ptr<const ShortestPathTree> tree = m.cityGraph.shortestPaths(from);
+            if (!tree->reachable(to))
+                return fail("No route from " + a[0] + " to " + a[1] + ".");
+            std::cout << "Distance " << a[0] << " -> " << a[1] << ": " << tree->distances[to] << "\nPath:";
+            for (int node : tree->pathTo(to))
+                std::cout << " " << m.cityGraph.getNodeName(node);
+            std::cout << "\n";
+            return true;
+        });
+        add("route.plan", "<depot> <capacity> <trucks>", 3, 3, [this, &m](const Args &a)
+        {
+            int depot = m.cityGraph.getNodeIndex(a[0]);
+            int capacity = std::stoi(a[1]), trucks = std::stoi(a[2]);
+            if (depot == -1 || capacity <= 0 || trucks <= 0)
+                return fail("Unknown depot or invalid truck details.");
+            std::vector<int> stopBinIds, skippedBinIds;
+            CollectionPlan plan = m.bins.planCollectionRuns(m.cityGraph, depot, capacity, trucks, stopBinIds, skippedBinIds);
+            for (size_t r = 0; r < plan.routes.size(); r++)
+            {
+                std::cout << "Truck " << r + 1 << " (load " << plan.routes[r].load << "%, distance " << plan.routes[r].distance
+                     << "):";
+                for (int stop : plan.routes[r].stops)
+                    std::cout << " Bin " << stopBinIds[stop];
+                std::cout << "\n";
+            }
+            std::cout << "Total distance: " << plan.totalDistance << ", unserved: " << plan.unserved.size()
+                 << ", off-network: " << skippedBinIds.size() << "\n";
+            return true;
+        });
+
+        add("bins.add", "<id> <location>", 2, 2, [this, &m](const Args &a)
+        {
+            return m.bins.addBin(std::stoi(a[0]), a[1]) || fail("Bin ID already exists.");
+        });
+        add("bins.fill", "<id> <level>", 2, 2, [this, &m](const Args &a)
+        {
+            return m.bins.setFillLevel(std::stoi(a[0]), std::stod(a[1])) || fail("Bin not found.");
+        });
+        add("bins.move", "<id> <location>", 2, 2, [this, &m](const Args &a)
+        {
+            return m.bins.setBinLocation(std::stoi(a[0]), a[1]) || fail("Bin not found.");
+        });
+        add("bins.remove", "<id>", 1, 1, [this, &m](const Args &a)
+        {
+            return m.bins.removeBin(std::stoi(a[0])) || fail("Bin not found.");
+        });
+
+        add("market.add", "<category> <name> <price>", 3, 3, [&m](const Args &a)
+        {
+            m.marketplace.addProduct(a[0], Product(a[1], a[0], std::stod(a[2])));
+            return true;
+        });
+        add("market.search", "<category>", 1, 1, [&m](const Args &a)
+        {
+            std::vector<Product> products = m.marketplace.searchProducts(a[0]);
+            std::cout << products.size() << " product(s) in " << a[0] << "\n";
+            for (const Product &product : products)
+                std::cout << "  " << product.name << ", $" << product.price << "\n";
+            return true;
+        });
+
+        add("forecast.add", "<DD-MM-YYYY> <location> <volume>", 3, 3, [&m](const Args &a)
+        {
+            m.prediction.addWasteData(a[0], a[1], std::stod(a[2]));
+            return true;
+        });
+        add("forecast.predict", "<location>", 1, 1, [&m](const Args &a)
+        {
+            std::vector<double> forecast = m.prediction.predictWasteVolume(a[0]);
+            for (size_t month = 0; month < forecast.size(); month++)
+                std::cout << "Month " << month + 1 << ": " << forecast[month] << " tons\n";
+            return !forecast.empty();
+        });
+
+        add("hazardous.enqueue", "<name> <category> [risk]", 2, 3, [this, &m](const Args &a)
+        {
+            int risk = a.size() > 2 ? std::stoi(a[2]) : m.hazardous.getDefaultRiskLevel(a[1]);
+            if (risk < 1 || risk > 10)
+                return fail("Risk level must be between 1 and 10.");
+            m.hazardous.enqueueHazardousItem(a[0], a[1], risk);
+            return true;
+        });
+        add("hazardous.queue", "", 0, 0, [&m](const Args &)
+        {
+            m.hazardous.viewDisposalQueue();
+            return true;
+        });
+
+        add("complaint.submit", "<citizen> <area> <text>", 3, ANY, [this, &m](const Args &a)
+        {
+            std::vector<ComplaintSubmission> batch(1, ComplaintSubmission{a[0], a[1], joined(a, 2)});
+            return m.complaints.submitComplaints(batch, m.priorities) == 1 ||
+                   fail("Complaint rejected: this citizen already has one in that area.");
+        });
+        add("complaint.classify", "<text>", 1, ANY, [&m](const Args &a)
+        {
+            std::cout << "Priority: " << m.priorities.getPriority(joined(a, 0)) << "\n";
+            return true;
+        });
+
+        add("carbon.cities", "<city>...", 1, ANY, [this, &m](const Args &a)
+        {
+            return m.carbon.initializeSystem(a) || fail("Cities are already set up, or too many were given.");
+        });
+        add("carbon.add-route", "<from> <to> <km> <type>", 4, 4, [this, &m](const Args &a)
+        {
+            return m.carbon.addRoute(a[0], a[1], std::stod(a[2]), a[3]) || fail("Unknown source or target city.");
+        });
+
+        add("food.add", "<donor> <location> <food> <quantity> <status>", 5, 5, [&m](const Args &a)
+        {
+            m.food.addFoodDonation(a[0], a[1], a[2], std::stoi(a[3]), a[4]);
+            return true;
+        });
+        add("food.search", "<location>", 1, 1, [&m](const Args &a)
+        {
+            m.food.searchFoodDonationByLocation(a[0]);
+            return true;
+        });
+
+        add("plastic.add", "<source> <kg> <status>", 3, 3, [&m](const Args &a)
+        {
+            m.plastic.addWasteRecord(a[0], std::stod(a[1]), a[2]);
+            return true;
+        });
+
+        add("metrics.reset", "", 0, 0, [](const Args &)
+        {
+            metrics().reset();
+            return true;
+        });
+        add("metrics.write", "<file.json>", 1, 1, [this](const Args &a)
+        {
+            return metrics().writeJson(a[0]) || fail("Cannot write " + a[0] + ".");
+        });
+        add("echo", "<text>...", 0, ANY, [](const Args &a)
+        {
+            std::cout << joined(a, 0) << "\n";
+            return true;
+        });
+    }
+
+public:
+    explicit BatchRunner(const SmartCityModules &modules) : modules(modules)
+    {
+        registerCommands();
+    }
+
+    // Splits a line into words; false on an unterminated quote
+    static bool tokenize(const std::string &line, std::vector<std::string> &words)
+    {
+        words.clear();
+        size_t i = 0;
+        while (true)
+        {
+            while (i < line.size() && std::isspace((unsigned char)line[i]))
+                i++;
+            if (i == line.size() || line[i] == '#')
+                return true;
+            std::string word;
+            while (i < line.size() && !std::isspace((unsigned char)line[i]))
+            {
+                if (line[i] == '"')
+                {
+                    size_t close = line.find('"', i + 1);
+                    if (close == std::string::npos)
+                        return false;
+                    word += line.substr(i + 1, close - i - 1);
+                    i = close + 1;
+                }
+                else
+                {
+                    word += line[i++];
+                }
+            }
+            words.push_back(word);
+        }
+    }
+
+    // Runs one command line; false if it is malformed, unknown or fails
+    bool runLine(const std::string &line)
+    {
+        std::vector<std::string> words;
+        if (!tokenize(line, words))
+            return fail("Unterminated quote.");
+        if (words.empty())
+            return true;
+
+        auto found = commands.find(words[0]);
+        if (found == commands.end())
+            return fail("Unknown command: " + words[0]);
+        const Command &command = found->second;
+        Args args(words.begin() + 1, words.end());
+        if (args.size() < command.minArgs || args.size() > command.maxArgs)
+            return fail("Usage: " + words[0] + " " + command.usage);
+
+        Counter &runs = metrics().counter("batch." + words[0] + ".runs");
+        Histogram &runTime = metrics().histogram("batch." + words[0]);
+        countEvent(runs);
+        ScopedTimer timer(runTime);
+        try
+        {
+            return command.run(args);
+        }
+        catch (const std::invalid_argument &)
+        {
+            return fail("Invalid number in: " + line);
+        }
+        catch (const std::out_of_range &)
+        {
+            return fail("Invalid number in: " + line);
+        }
+    }
+
+    // Runs every line of the file and returns how many commands failed, or -1 if
+    // the file cannot be opened
+    int runFile(const std::string &fileName)
+    {
+        std::ifstream inFile(fileName);
+        if (!inFile.is_open())
+        {
+            std::cout << "Cannot open command file " << fileName << ".\n";
+            return -1;
+        }
+        return runStream(inFile, fileName);
+    }
+
+    int runStream(std::istream &in, const std::string &sourceName)
+    {
+        int failures = 0, lineNumber = 0;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            lineNumber++;
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (!runLine(line))
+            {
+                std::cout << sourceName << ":" << lineNumber << ": command failed\n";
+                failures++;
+            }
+        }
+        return failures;
+    }
+
+    void printUsage(std::ostream &out) const
+    {
+        for (const auto &entry : commands)
+            out << "  " << entry.first << " " << entry.second.usage << "\n";
+    }
+};
+
+#endif
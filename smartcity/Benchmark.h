@@ -0,0 +1,271 @@
+// smartcity/Benchmark.h
+// Minimal Google-Benchmark-style harness, so the suite builds without external
+// dependencies. A benchmark is a function taking a BenchmarkState:
+//
+//     registerBenchmark("search/products", [](BenchmarkState &state)
+//     {
+//         Catalog catalog = generateCatalog(state.range());  // setup, not timed
+//         while (state.keepRunning())
+//             doNotOptimize(catalog.search("plastic"));
+//         state.setItemsProcessed(state.iterations());
+//     }, {1000, 100000});
+//
+// The runner calls it with a growing iteration count until one run takes at
+// least minSeconds, then reports the time per iteration of that run.
+#ifndef SMARTCITY_BENCHMARK_H
+#define SMARTCITY_BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Keeps the compiler from discarding a value that is computed but never used
+template <typename T>
+inline void doNotOptimize(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+class BenchmarkState
+{
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    int64_t argument;
+    int64_t maxIterations;
+    int64_t completed;
+    int64_t items;
+    int64_t bytes;
+    bool started;
+    bool paused;
+    Clock::time_point runningSince;
+    Clock::duration elapsed;
+
+public:
+    BenchmarkState(int64_t argument, int64_t iterations)
+        : argument(argument), maxIterations(iterations), completed(0), items(0), bytes(0), started(false),
+          paused(false), elapsed(0)
+    {
+    }
+
+    // Loop condition of the timed region; the clock starts on the first call
+    bool keepRunning()
+    {
+        if (!started)
+        {
+            started = true;
+            runningSince = Clock::now();
+        }
+        if (completed < maxIterations)
+        {
+            completed++;
+            return true;
+        }
+        if (!paused)
+        {
+            elapsed += Clock::now() - runningSince;
+            paused = true;
+        }
+        return false;
+    }
+
+    // Excludes per-iteration setup from the measurement
+    void pauseTiming()
+    {
+        if (!paused)
+        {
+            elapsed += Clock::now() - runningSince;
+            paused = true;
+        }
+    }
+
+    void resumeTiming()
+    {
+        if (paused)
+        {
+            runningSince = Clock::now();
+            paused = false;
+        }
+    }
+
+    int64_t range() const
+    {
+        return argument;
+    }
+
+    int64_t iterations() const
+    {
+        return maxIterations;
+    }
+
+    void setItemsProcessed(int64_t count)
+    {
+        items = count;
+    }
+
+    void setBytesProcessed(int64_t count)
+    {
+        bytes = count;
+    }
+
+    double seconds() const
+    {
+        return std::chrono::duration<double>(elapsed).count();
+    }
+
+    int64_t itemsProcessed() const
+    {
+        return items;
+    }
+
+    int64_t bytesProcessed() const
+    {
+        return bytes;
+    }
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+    int64_t iterations;
+    double nanosPerIteration;
+    double itemsPerSecond; // 0 when the benchmark did not report items
+    double bytesPerSecond;
+};
+
+class BenchmarkRegistry
+{
+private:
+    struct Case
+    {
+        std::string name;
+        std::function<void(BenchmarkState &)> body;
+        std::vector<int64_t> arguments; // one run per argument; empty means a single run
+    };
+
+    std::vector<Case> cases;
+
+    static BenchmarkResult runOnce(const std::string &name, const std::function<void(BenchmarkState &)> &body, int64_t argument,
+                                   double minSeconds)
+    {
+        int64_t iterations = 1;
+        while (true)
+        {
+            BenchmarkState state(argument, iterations);
+            body(state);
+            double seconds = state.seconds();
+            if (seconds >= minSeconds || iterations >= 1000000000)
+            {
+                BenchmarkResult result;
+                result.name = name;
+                result.iterations = iterations;
+                result.nanosPerIteration = seconds * 1e9 / iterations;
+                result.itemsPerSecond = seconds > 0 ? state.itemsProcessed() / seconds : 0;
+                result.bytesPerSecond = seconds > 0 ? state.bytesProcessed() / seconds : 0;
+                return result;
+            }
+            // Aim 40% past the target so the next run usually is the last one
+            double scale = seconds > 0 ? minSeconds * 1.4 / seconds : 100;
+            iterations = (int64_t)(iterations * std::min(100.0, std::max(2.0, scale)));
+        }
+    }
+
+    static std::string humanRate(double perSecond, const char *unit)
+    {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(2);
+        if (perSecond >= 1e9)
+            out << perSecond / 1e9 << "G";
+        else if (perSecond >= 1e6)
+            out << perSecond / 1e6 << "M";
+        else if (perSecond >= 1e3)
+            out << perSecond / 1e3 << "k";
+        else
+            out << perSecond;
+        out << unit << "/s";
+        return out.str();
+    }
+
+public:
+    void add(const std::string &name, std::function<void(BenchmarkState &)> body, std::vector<int64_t> arguments = {})
+    {
+        cases.push_back({name, body, arguments});
+    }
+
+    // Runs every benchmark whose full name contains filter and prints one row each
+    std::vector<BenchmarkResult> run(const std::string &filter = "", double minSeconds = 0.5, std::ostream &out = std::cout) const
+    {
+        std::vector<BenchmarkResult> results;
+        out << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(16) << "Time" << std::setw(14) << "Iterations"
+            << "  Throughput\n"
+            << std::string(96, '-') << "\n";
+        for (const Case &benchmark : cases)
+        {
+            std::vector<int64_t> arguments = benchmark.arguments;
+            if (arguments.empty())
+                arguments.push_back(0);
+            for (int64_t argument : arguments)
+            {
+                std::string name = benchmark.name;
+                if (!benchmark.arguments.empty())
+                    name += "/" + std::to_string(argument);
+                if (name.find(filter) == std::string::npos)
+                    continue;
+
+                BenchmarkResult result = runOnce(name, benchmark.body, argument, minSeconds);
+                results.push_back(result);
+
+                std::ostringstream time;
+                time << std::fixed << std::setprecision(result.nanosPerIteration < 100 ? 2 : 0) << result.nanosPerIteration
+                     << " ns";
+                out << std::left << std::setw(48) << name << std::right << std::setw(16) << time.str() << std::setw(14) << result.iterations;
+                if (result.itemsPerSecond > 0)
+                    out << "  " << humanRate(result.itemsPerSecond, " items");
+                if (result.bytesPerSecond > 0)
+                    out << "  " << humanRate(result.bytesPerSecond, "B");
+                out << std::endl;
+            }
+        }
+        return results;
+    }
+
+    static std::string toJson(const std::vector<BenchmarkResult> &results)
+    {
+        std::ostringstream out;
+        out << "{\n  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const BenchmarkResult &result = results[i];
+            out << (i ? ",\n" : "\n") << "    {\"name\": \"" << result.name << "\", \"iterations\": " << result.iterations
+                << std::fixed << std::setprecision(3) << ", \"real_time_ns\": " << result.nanosPerIteration
+                << ", \"items_per_second\": " << result.itemsPerSecond
+                << ", \"bytes_per_second\": " << result.bytesPerSecond << "}";
+        }
+        out << (results.empty() ? "]" : "\n  ]") << "\n}\n";
+        return out.str();
+    }
+};
+
+inline BenchmarkRegistry &benchmarks()
+{
+    static BenchmarkRegistry registry;
+    return registry;
+}
+
+inline void registerBenchmark(const std::string &name, std::function<void(BenchmarkState &)> body, std::vector<int64_t> arguments = {})
+{
+    benchmarks().add(name, body, arguments);
+}
+
+#endif
@@ -0,0 +1,465 @@
+// smartcity/Benchmarks.h
+// Benchmark suite for the SMART-CITY modules (--bench), with synthetic data
+// generators. Generated data is imported into module stores in a scratch
+// directory under the system temp directory, so a run never touches the real
+// .wal/.snap files.
+//
+//   routing/   shortest-path trees, distance matrices and truck plans on a road grid
+//   storage/   loading and compacting each module's snapshot
+//   search/    catalog, donation and complaint lookups
+//   forecast/  waste volume forecasts over generated history
+#ifndef SMARTCITY_BENCHMARKS_H
+#define SMARTCITY_BENCHMARKS_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Bin_monitoring.h"
+#include "Complaints.h"
+#include "Food_waste.h"
+#include "Marketplace.h"
+#include "Routing.h"
+#include "Volume_prediction.h"
+
+// Synthetic data generators------------------------------------------------------------------------------
+const char *const BENCH_CATEGORIES[] = {"Plastic", "Paper", "Glass", "Metal", "Textile", "Electronics", "Wood", "Rubber"};
+const char *const BENCH_FOODS[] = {"rice", "bread", "curry", "fruit", "vegetables", "dal", "sweets", "salad"};
+const int BENCH_CATEGORY_COUNT = sizeof(BENCH_CATEGORIES) / sizeof(BENCH_CATEGORIES[0]);
+const int BENCH_FOOD_COUNT = sizeof(BENCH_FOODS) / sizeof(BENCH_FOODS[0]);
+
+// Road network on a square grid: every point links to its right and lower
+// neighbours (1-5 km), plus one long shortcut per 16 points
+inline std::vector<std::vector<Edge>> generateRoadNetwork(int nodeCount, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> street(1.0f, 5.0f);
+    int side = 1;
+    while (side * side < nodeCount)
+        side++;
+
+    std::vector<std::vector<Edge>> adjList(nodeCount);
+    auto link = [&](int from, int to, float weight)
+    {
+        adjList[from].push_back(Edge(from, to, weight));
+        adjList[to].push_back(Edge(to, from, weight));
+    };
+    for (int node = 0; node < nodeCount; node++)
+    {
+        if ((node + 1) % side != 0 && node + 1 < nodeCount)
+            link(node, node + 1, street(rng));
+        if (node + side < nodeCount)
+            link(node, node + side, street(rng));
+    }
+    std::uniform_int_distribution<int> anyNode(0, nodeCount - 1);
+    for (int i = 0; i < nodeCount / 16; i++)
+    {
+        int from = anyNode(rng), to = anyNode(rng);
+        if (from != to)
+            link(from, to, street(rng) * 8);
+    }
+    return adjList;
+}
+
+inline std::string collectionPointName(int node)
+{
+    return "Point " + std::to_string(node);
+}
+
+// Writes a road network in the format Graph imports (graph.txt)
+inline void writeGraphFile(const std::string &fileName, const std::vector<std::vector<Edge>> &adjList)
+{
+    std::ofstream outFile(fileName);
+    outFile << adjList.size() << "\n";
+    for (size_t node = 0; node < adjList.size(); node++)
+        outFile << collectionPointName(node) << "\n";
+    for (const auto &edges : adjList)
+    {
+        for (const Edge &edge : edges)
+            outFile << edge.from << " " << edge.to << " " << edge.weight << "\n";
+    }
+}
+
+// bins.txt: bins spread over the first `locations` collection points; about a third are due for collection
+inline void writeBinsFile(const std::string &fileName, int binCount, int locations, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::ofstream outFile(fileName);
+    for (int id = 1; id <= binCount; id++)
+    {
+        int fill = rng() % 101;
+        outFile << id << "," << collectionPointName(rng() % locations) << "," << fill << "," << (fill >= 67) << ",0\n";
+    }
+}
+
+// products.txt: products over BENCH_CATEGORIES, priced 1-500
+inline void writeProductsFile(const std::string &fileName, int productCount, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::ofstream outFile(fileName);
+    for (int i = 0; i < productCount; i++)
+    {
+        const char *category = BENCH_CATEGORIES[rng() % BENCH_CATEGORY_COUNT];
+        outFile << category << "," << category << " item " << i << "," << 1 + rng() % 50000 / 100.0 << "\n";
+    }
+}
+
+// food_donations.txt: donations over `locations` areas
+inline void writeDonationsFile(const std::string &fileName, int donationCount, int locations, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::ofstream outFile(fileName);
+    for (int i = 0; i < donationCount; i++)
+    {
+        outFile << "donor " << i << ",area " << rng() % locations << "," << BENCH_FOODS[rng() % BENCH_FOOD_COUNT] << ","
+                << 1 + rng() % 200 << "," << (rng() % 4 == 0 ? "near expiry" : "fresh") << "\n";
+    }
+}
+
+// waste_data.txt: monthly readings per location with a slow upward trend and noise
+inline void writeWasteHistoryFile(const std::string &fileName, int locations, int months, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> noise(0.0, 3.0);
+    std::ofstream outFile(fileName);
+    char date[16];
+    for (int month = 0; month < months; month++)
+    {
+        snprintf(date, sizeof(date), "01-%02d-%04d", month % 12 + 1, 2015 + month / 12);
+        for (int location = 0; location < locations; location++)
+        {
+            double volume = 20 + location % 50 + 0.1 * month + noise(rng);
+            outFile << date << ",Ward " << location << "," << std::max(0.0, volume) << "\n";
+        }
+    }
+}
+
+// Synthetic night of complaints: mostly filler words with the occasional keyword
+inline std::vector<std::string> generateComplaintTexts(int count, unsigned seed)
+{
+    static const char *filler[] = {"the", "bin", "near", "my", "house", "has", "not", "been", "collected", "for",
+                                   "three", "days", "and", "street", "smells", "garbage", "truck", "missed", "our",
+                                   "lane", "again", "overflowing", "please", "look", "into", "this", "area", "waste"};
+    static const char *keywords[] = {"urgent", "Life-Threatening", "system down", "fraud", "refund", "broken",
+                                     "locked out", "slow", "wrong", "update", "how to", "suggestion", "manual",
+                                     "feedback", "thank", "Emergency", "DATA LEAK", "waiting", "support"};
+    const int fillerCount = sizeof(filler) / sizeof(filler[0]);
+    const int keywordCount = sizeof(keywords) / sizeof(keywords[0]);
+
+    srand(seed);
+    std::vector<std::string> texts(count);
+    for (std::string &text : texts)
+    {
+        int words = 12 + rand() % 20;
+        for (int w = 0; w < words; w++)
+        {
+            if (w > 0)
+                text += ' ';
+            text += (rand() % 25 == 0) ? keywords[rand() % keywordCount] : filler[rand() % fillerCount];
+        }
+    }
+    return texts;
+}
+
+inline int64_t fileBytes(const std::string &fileName)
+{
+    std::error_code error;
+    uintmax_t size = std::filesystem::file_size(fileName, error);
+    return error ? 0 : (int64_t)size;
+}
+
+// Scratch directory for generated state files, removed when the suite finishes
+class BenchScratch
+{
+private:
+    std::filesystem::path root;
+
+public:
+    BenchScratch()
+    {
+        root = std::filesystem::temp_directory_path() / ("smartcity-bench-" + std::to_string((long long)time(nullptr)));
+        std::filesystem::create_directories(root);
+    }
+
+    ~BenchScratch()
+    {
+        std::error_code error;
+        std::filesystem::remove_all(root, error);
+    }
+
+    std::string file(const std::string &name) const
+    {
+        return (root / name).string();
+    }
+
+    // A module store name in the scratch directory. Ranges reuse the name, so
+    // the previous range's log and snapshot are removed first.
+    std::string store(const std::string &name) const
+    {
+        std::string path = file(name);
+        for (const char *suffix : {".wal", ".snap", ".snap.tmp"})
+        {
+            std::error_code error;
+            std::filesystem::remove(path + suffix, error);
+        }
+        return path;
+    }
+};
+
+inline BenchScratch &benchScratch()
+{
+    static BenchScratch scratch;
+    return scratch;
+}
+//-------------------------------------------------------------------------------------------------------
+
+// Benchmark suite----------------------------------------------------------------------------------------
+inline void registerRoutingBenchmarks()
+{
+    // Uncached single-source trees, the cost of a first "optimize routes" query
+    registerBenchmark("routing/shortest_path_tree", [](BenchmarkState &state)
+    {
+        std::vector<std::vector<Edge>> adjList = generateRoadNetwork(state.range(), 1);
+        RoutingEngine engine(0);
+        engine.rebuild(adjList);
+        std::mt19937 rng(2);
+        while (state.keepRunning())
+            doNotOptimize(engine.shortestPaths(adjList, rng() % adjList.size()));
+        state.setItemsProcessed(state.iterations());
+    }, {1000, 10000, 100000});
+
+    // Repeat queries from a few depots hit the tree cache
+    registerBenchmark("routing/cached_tree", [](BenchmarkState &state)
+    {
+        std::vector<std::vector<Edge>> adjList = generateRoadNetwork(state.range(), 1);
+        RoutingEngine engine(32);
+        engine.rebuild(adjList);
+        std::mt19937 rng(3);
+        while (state.keepRunning())
+            doNotOptimize(engine.shortestPaths(adjList, rng() % 16));
+        state.setItemsProcessed(state.iterations());
+    }, {10000});
+
+    // Pairwise distances between `range` bins on a 10k point network
+    registerBenchmark("routing/distance_matrix", [](BenchmarkState &state)
+    {
+        std::vector<std::vector<Edge>> adjList = generateRoadNetwork(10000, 1);
+        RoutingEngine engine;
+        engine.rebuild(adjList);
+        std::mt19937 rng(4);
+        std::vector<int> stops(state.range());
+        for (int &stop : stops)
+            stop = rng() % adjList.size();
+        while (state.keepRunning())
+            doNotOptimize(computeDistanceMatrix(engine, stops));
+        state.setItemsProcessed(state.iterations() * state.range() * state.range());
+    }, {50, 200});
+
+    // Savings + 2-opt truck plan over a precomputed matrix
+    registerBenchmark("routing/collection_plan", [](BenchmarkState &state)
+    {
+        std::vector<std::vector<Edge>> adjList = generateRoadNetwork(10000, 1);
+        RoutingEngine engine;
+        engine.rebuild(adjList);
+        std::mt19937 rng(5);
+        std::vector<int> stops(state.range() + 1), demand(state.range() + 1);
+        for (size_t i = 0; i < stops.size(); i++)
+        {
+            stops[i] = rng() % adjList.size();
+            demand[i] = i == 0 ? 0 : 20 + rng() % 81;
+        }
+        DistanceMatrix matrix = computeDistanceMatrix(engine, stops);
+        while (state.keepRunning())
+            doNotOptimize(planCollectionRoutes(matrix, 0, demand, 1000, state.range() / 5 + 1));
+        state.setItemsProcessed(state.iterations() * state.range());
+    }, {50, 200});
+}
+
+// Each module is given its store name and a legacy <store>.txt of generated
+// data, which the first construction imports into <store>.snap. Load = a later
+// construction, which reads the snapshot; save = compacting it into a fresh one.
+template <typename Module>
+void benchmarkModuleLoad(BenchmarkState &state, const std::string &store)
+{
+    {
+        Module importer(store, store + ".txt");
+    }
+    while (state.keepRunning())
+    {
+        std::unique_ptr<Module> module(new Module(store, store + ".txt"));
+        state.pauseTiming();
+        module.reset();
+        state.resumeTiming();
+    }
+    state.setBytesProcessed(state.iterations() * fileBytes(store + ".snap"));
+}
+
+template <typename Module>
+void benchmarkModuleSave(BenchmarkState &state, const std::string &store)
+{
+    Module module(store, store + ".txt");
+    while (state.keepRunning())
+        module.compact();
+    state.setBytesProcessed(state.iterations() * fileBytes(store + ".snap"));
+}
+
+inline void registerStorageBenchmarks()
+{
+    registerBenchmark("storage/graph_load", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("graph");
+        writeGraphFile(store + ".txt", generateRoadNetwork(state.range(), 1));
+        benchmarkModuleLoad<Graph>(state, store);
+    }, {10000, 100000});
+
+    registerBenchmark("storage/graph_save", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("graph");
+        writeGraphFile(store + ".txt", generateRoadNetwork(state.range(), 1));
+        benchmarkModuleSave<Graph>(state, store);
+    }, {10000, 100000});
+
+    registerBenchmark("storage/bins_load", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("bins");
+        writeBinsFile(store + ".txt", state.range(), 1000, 1);
+        benchmarkModuleLoad<Bin_Monitoring_System>(state, store);
+    }, {10000, 100000});
+
+    registerBenchmark("storage/bins_save", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("bins");
+        writeBinsFile(store + ".txt", state.range(), 1000, 1);
+        benchmarkModuleSave<Bin_Monitoring_System>(state, store);
+    }, {10000, 100000});
+
+    registerBenchmark("storage/products_load", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("products");
+        writeProductsFile(store + ".txt", state.range(), 1);
+        benchmarkModuleLoad<Recycled_Product_Marketplace>(state, store);
+    }, {10000, 100000});
+
+    registerBenchmark("storage/products_save", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("products");
+        writeProductsFile(store + ".txt", state.range(), 1);
+        benchmarkModuleSave<Recycled_Product_Marketplace>(state, store);
+    }, {10000, 100000});
+
+    registerBenchmark("storage/donations_load", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("donations");
+        writeDonationsFile(store + ".txt", state.range(), 500, 1);
+        benchmarkModuleLoad<FoodWasteManagementSystem>(state, store);
+    }, {10000, 100000});
+
+    registerBenchmark("storage/donations_save", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("donations");
+        writeDonationsFile(store + ".txt", state.range(), 500, 1);
+        benchmarkModuleSave<FoodWasteManagementSystem>(state, store);
+    }, {10000, 100000});
+
+    // range = locations, 120 months each
+    registerBenchmark("storage/waste_history_load", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("waste_data");
+        writeWasteHistoryFile(store + ".txt", state.range(), 120, 1);
+        benchmarkModuleLoad<WastePredictionSystem>(state, store);
+    }, {100, 1000});
+
+    registerBenchmark("storage/waste_history_save", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("waste_data");
+        writeWasteHistoryFile(store + ".txt", state.range(), 120, 1);
+        benchmarkModuleSave<WastePredictionSystem>(state, store);
+    }, {100, 1000});
+}
+
+inline void registerSearchBenchmarks()
+{
+    registerBenchmark("search/products_by_category", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("products");
+        writeProductsFile(store + ".txt", state.range(), 1);
+        Recycled_Product_Marketplace marketplace(store, store + ".txt");
+        std::mt19937 rng(6);
+        while (state.keepRunning())
+            doNotOptimize(marketplace.searchProducts(BENCH_CATEGORIES[rng() % BENCH_CATEGORY_COUNT]));
+        state.setItemsProcessed(state.iterations());
+    }, {10000, 100000});
+
+    registerBenchmark("search/donations_by_location", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("donations");
+        writeDonationsFile(store + ".txt", state.range(), 500, 1);
+        FoodWasteManagementSystem food(store, store + ".txt");
+        std::mt19937 rng(7);
+        while (state.keepRunning())
+            doNotOptimize(food.findDonationsByLocation("area " + std::to_string(rng() % 500)));
+        state.setItemsProcessed(state.iterations());
+    }, {10000, 100000});
+
+    // Batches of `range` complaints through the keyword DFA
+    registerBenchmark("search/complaint_priority", [](BenchmarkState &state)
+    {
+        std::vector<std::string> texts = generateComplaintTexts(state.range(), 7);
+        ComplaintPriority prioritySystem;
+        int64_t bytes = 0;
+        for (const std::string &text : texts)
+            bytes += text.size();
+        while (state.keepRunning())
+            doNotOptimize(prioritySystem.classify(texts));
+        state.setItemsProcessed(state.iterations() * state.range());
+        state.setBytesProcessed(state.iterations() * bytes);
+    }, {4096, 65536});
+}
+
+inline void registerForecastBenchmarks()
+{
+    // One location's 3 month forecast; range = months of history per location
+    registerBenchmark("forecast/predict_location", [](BenchmarkState &state)
+    {
+        const int locations = 500;
+        std::string store = benchScratch().store("waste_data");
+        writeWasteHistoryFile(store + ".txt", locations, state.range(), 1);
+        WastePredictionSystem prediction(store, store + ".txt");
+        std::mt19937 rng(8);
+        while (state.keepRunning())
+            doNotOptimize(prediction.predictWasteVolume("Ward " + std::to_string(rng() % locations)));
+        state.setItemsProcessed(state.iterations());
+    }, {12, 120});
+
+    // Forecast for every location, as a citywide report would
+    registerBenchmark("forecast/all_locations", [](BenchmarkState &state)
+    {
+        std::string store = benchScratch().store("waste_data");
+        writeWasteHistoryFile(store + ".txt", state.range(), 120, 1);
+        WastePredictionSystem prediction(store, store + ".txt");
+        while (state.keepRunning())
+        {
+            for (int location = 0; location < state.range(); location++)
+                doNotOptimize(prediction.predictWasteVolume("Ward " + std::to_string(location)));
+        }
+        state.setItemsProcessed(state.iterations() * state.range());
+    }, {100, 1000});
+}
+
+inline void registerSmartCityBenchmarks()
+{
+    registerRoutingBenchmarks();
+    registerStorageBenchmarks();
+    registerSearchBenchmarks();
+    registerForecastBenchmarks();
+}
+
+#endif
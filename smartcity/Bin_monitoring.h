@@ -0,0 +1,421 @@
+// smartcity/Bin_monitoring.h
+// Smart Bin Monitoring System: bin fill levels and collection planning.
+#ifndef SMARTCITY_BIN_MONITORING_H
+#define SMARTCITY_BIN_MONITORING_H
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <queue>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+#include "Instrumentation.h"
+#include "Routing.h"
+
+class Bin_Monitoring_System
+{
+private:
+    struct Bin
+    {
+        int id;
+        std::string location;
+        double fillLevel;
+        bool needsCollection;
+        bool underMaintenance;
+    };
+
+    std::vector<Bin> bins;
+    std::map<std::string, std::vector<int>> locationBins;
+    std::queue<int> collectionQueue;
+
+    const double FILL_THRESHOLD = 80.0;
+    bool isAdminLoggedIn;
+    std::string legacyFile;
+    WalStore store; // one record per bin, keyed by walKey(id)
+
+    Bin *findBin(int binId)
+    {
+        for (Bin &bin : bins)
+        {
+            if (bin.id == binId)
+                return &bin;
+        }
+        return nullptr;
+    }
+
+    static std::string encodeBin(const Bin &bin)
+    {
+        return RecordWriter().putInt(bin.id).putString(bin.location).putDouble(bin.fillLevel)
+            .putInt(bin.needsCollection).putInt(bin.underMaintenance).str();
+    }
+
+    // Appends one bin's current state to the log
+    void saveBin(const Bin &bin)
+    {
+        store.put(walKey(bin.id), encodeBin(bin));
+    }
+
+    void saveBinsToFile(WalStore::SnapshotWriter &out) const
+    {
+        static Histogram &saveTime = metrics().histogram("storage.bins.save");
+        ScopedTimer timer(saveTime);
+
+        for (const auto &bin : bins)
+        {
+            out.put(walKey(bin.id), encodeBin(bin));
+        }
+    }
+
+    void restoreBin(const Bin &bin)
+    {
+        bins.push_back(bin);
+        locationBins[bin.location].push_back(bin.id);
+        if (bin.needsCollection)
+        {
+            collectionQueue.push(bin.id);
+        }
+    }
+
+    void loadBinsFromFile()
+    {
+        static Histogram &loadTime = metrics().histogram("storage.bins.load");
+        ScopedTimer timer(loadTime);
+
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importBinsFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records)
+        {
+            RecordReader in(record.second);
+            Bin bin;
+            bin.id = in.getInt();
+            bin.location = in.getString();
+            bin.fillLevel = in.getDouble();
+            bin.needsCollection = in.getInt();
+            bin.underMaintenance = in.getInt();
+            restoreBin(bin);
+        }
+    }
+
+    // One-time migration from the old comma-separated bins.txt
+    void importBinsFromTextFile()
+    {
+        std::ifstream inFile(legacyFile);
+        if (inFile.is_open())
+        {
+            std::string line;
+            while (std::getline(inFile, line))
+            {
+                size_t pos1 = line.find(',');
+                size_t pos2 = line.find(',', pos1 + 1);
+                size_t pos3 = line.find(',', pos2 + 1);
+                size_t pos4 = line.find(',', pos3 + 1);
+
+                int id = std::stoi(line.substr(0, pos1));
+                std::string location = line.substr(pos1 + 1, pos2 - pos1 - 1);
+                double fillLevel = std::stod(line.substr(pos2 + 1, pos3 - pos2 - 1));
+                bool needsCollection = std::stoi(line.substr(pos3 + 1, pos4 - pos3 - 1));
+                bool underMaintenance = std::stoi(line.substr(pos4 + 1));
+                restoreBin({id, location, fillLevel, needsCollection, underMaintenance});
+            }
+            inFile.close();
+        }
+    }
+
+public:
+    // Every change appends the bin's record to <storeName>.wal; the constructor
+    // loads the snapshot and replays the log tail
+    explicit Bin_Monitoring_System(const std::string &storeName = "smartcity_bins",
+                                   const std::string &legacyFile = "bins.txt")
+        : isAdminLoggedIn(false), legacyFile(legacyFile),
+          store(storeName, [this](WalStore::SnapshotWriter &out) { saveBinsToFile(out); })
+    {
+        loadBinsFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    // Non-interactive API; each call returns false if the bin ID is taken or unknown
+    bool addBin(int binId, const std::string &location)
+    {
+        if (findBin(binId))
+            return false;
+        bins.push_back({binId, location, 0.0, false, false});
+        locationBins[location].push_back(binId);
+        saveBin(bins.back());
+        return true;
+    }
+
+    bool setBinLocation(int binId, const std::string &location)
+    {
+        Bin *bin = findBin(binId);
+        if (!bin)
+            return false;
+        std::vector<int> &oldLocation = locationBins[bin->location];
+        oldLocation.erase(std::remove(oldLocation.begin(), oldLocation.end(), binId), oldLocation.end());
+        bin->location = location;
+        locationBins[location].push_back(binId);
+        saveBin(*bin);
+        return true;
+    }
+
+    bool removeBin(int binId)
+    {
+        for (auto it = bins.begin(); it != bins.end(); ++it)
+        {
+            if (it->id == binId)
+            {
+                locationBins[it->location].erase(
+                    std::remove(locationBins[it->location].begin(), locationBins[it->location].end(), binId),
+                    locationBins[it->location].end());
+                bins.erase(it);
+                store.erase(walKey(binId));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Queues the bin for collection once it crosses FILL_THRESHOLD
+    bool setFillLevel(int binId, double fillLevel)
+    {
+        Bin *bin = findBin(binId);
+        if (!bin)
+            return false;
+        bin->fillLevel = fillLevel;
+        if (bin->fillLevel >= FILL_THRESHOLD && !bin->needsCollection)
+        {
+            bin->needsCollection = true;
+            collectionQueue.push(bin->id);
+        }
+        saveBin(*bin);
+        return true;
+    }
+
+    bool needsCollection(int binId)
+    {
+        Bin *bin = findBin(binId);
+        return bin && bin->needsCollection;
+    }
+
+    size_t binCount() const
+    {
+        return bins.size();
+    }
+
+    // Admin Functions
+    void addBin()
+    {
+        int binId;
+        std::string location;
+        std::cout << "Enter bin ID: ";
+        std::cin >> binId;
+
+        // Check for duplicate bin ID
+        if (findBin(binId))
+        {
+            std::cout << "Error: Bin ID already exists.\n";
+            return;
+        }
+
+        std::cout << "Enter location: ";
+        std::cin.ignore();
+        std::getline(std::cin, location);
+
+        addBin(binId, location);
+        std::cout << "Bin added successfully!\n";
+    }
+
+    void editBinDetails()
+    {
+
+        int binId;
+        std::cout << "Enter bin ID to edit: ";
+        std::cin >> binId;
+
+        if (!findBin(binId))
+        {
+            std::cout << "Bin not found.\n";
+            return;
+        }
+        std::string location;
+        std::cout << "Enter new location: ";
+        std::cin.ignore();
+        std::getline(std::cin, location);
+        setBinLocation(binId, location);
+        std::cout << "Bin details updated successfully!\n";
+    }
+
+    void deleteBin()
+    {
+
+        int binId;
+        std::cout << "Enter bin ID to delete: ";
+        std::cin >> binId;
+
+        if (removeBin(binId))
+        {
+            std::cout << "Bin deleted successfully!\n";
+        }
+        else
+        {
+            std::cout << "Bin not found.\n";
+        }
+    }
+
+    void updateBinStatus()
+    {
+
+        int binId;
+        std::cout << "Enter bin ID: ";
+        std::cin >> binId;
+
+        if (!findBin(binId))
+        {
+            std::cout << "Bin not found.\n";
+            return;
+        }
+        bool wasPending = needsCollection(binId);
+        double fillLevel;
+        std::cout << "Enter new fill level (0-100): ";
+        std::cin >> fillLevel;
+        setFillLevel(binId, fillLevel);
+        if (!wasPending && needsCollection(binId))
+        {
+            std::cout << "Alert: Bin needs collection!\n";
+        }
+    }
+
+    void viewBinStatus() const
+    {
+        if (bins.empty())
+        {
+            std::cout << "No bins available.\n";
+            return;
+        }
+
+        std::cout << "\n=== Bin Status ===\n";
+        for (const Bin &bin : bins)
+        {
+            std::cout << "Bin " << bin.id << " at " << bin.location << ":\n";
+            std::cout << "Fill Level: " << bin.fillLevel << "%\n";
+            std::cout << "Status: " << (bin.needsCollection ? "Needs collection" : "OK") << "\n";
+            std::cout << "Maintenance: " << (bin.underMaintenance ? "Under Maintenance" : "Operational") << "\n\n";
+        }
+    }
+
+    // Bins waiting in the collection queue, without the duplicates the queue can hold
+    std::vector<int> pendingCollectionIds() const
+    {
+        std::vector<int> ids;
+        std::set<int> seen;
+        std::queue<int> pending = collectionQueue;
+        while (!pending.empty())
+        {
+            if (seen.insert(pending.front()).second)
+            {
+                ids.push_back(pending.front());
+            }
+            pending.pop();
+        }
+        return ids;
+    }
+
+    // Plans truck tours for every pending bin; each bin sits at the collection point named by its location
+    CollectionPlan planCollectionRuns(const Graph &cityGraph, int depotNode, int truckCapacity, int truckCount,
+                                      std::vector<int> &stopBinIds, std::vector<int> &skippedBinIds) const
+    {
+        static Histogram &planTime = metrics().histogram("routing.collection_plan");
+
+        std::vector<int> stops(1, depotNode);
+        std::vector<int> demand(1, 0);
+        stopBinIds.assign(1, -1);
+        skippedBinIds.clear();
+
+        for (int binId : pendingCollectionIds())
+        {
+            auto bin = std::find_if(bins.begin(), bins.end(), [binId](const Bin &b)
+                               { return b.id == binId; });
+            int node = bin == bins.end() ? -1 : cityGraph.getNodeIndex(bin->location);
+            if (node == -1)
+            {
+                skippedBinIds.push_back(binId);
+                continue;
+            }
+            stops.push_back(node);
+            demand.push_back((int)std::ceil(bin->fillLevel));
+            stopBinIds.push_back(binId);
+        }
+
+        DistanceMatrix matrix = cityGraph.distanceMatrix(stops);
+        ScopedTimer timer(planTime);
+        return ::planCollectionRoutes(matrix, 0, demand, truckCapacity, truckCount);
+    }
+
+    void planCollectionRoutes(const Graph &cityGraph)
+    {
+        std::string depotName;
+        int truckCapacity, truckCount;
+        std::cout << "Enter depot collection point name: ";
+        std::cin.ignore();
+        std::getline(std::cin, depotName);
+        int depotNode = cityGraph.getNodeIndex(depotName);
+        if (depotNode == -1)
+        {
+            std::cout << "Depot collection point not found.\n";
+            return;
+        }
+        std::cout << "Enter truck capacity (in % of one bin, e.g. 1000 = ten full bins): ";
+        std::cin >> truckCapacity;
+        std::cout << "Enter number of trucks: ";
+        std::cin >> truckCount;
+        if (std::cin.fail() || truckCapacity <= 0 || truckCount <= 0)
+        {
+            std::cin.clear();
+            std::cin.ignore(INT_MAX, '\n');
+            std::cout << "Invalid truck details.\n";
+            return;
+        }
+
+        std::vector<int> stopBinIds, skippedBinIds;
+        CollectionPlan plan = planCollectionRuns(cityGraph, depotNode, truckCapacity, truckCount, stopBinIds, skippedBinIds);
+
+        std::cout << "\n=== Collection Plan ===\n";
+        for (size_t r = 0; r < plan.routes.size(); ++r)
+        {
+            const VehicleRoute &route = plan.routes[r];
+            std::cout << "Truck " << r + 1 << " (load " << route.load << "%, distance " << route.distance << "): " << depotName;
+            for (int stop : route.stops)
+            {
+                std::cout << " -> Bin " << stopBinIds[stop];
+            }
+            std::cout << " -> " << depotName << "\n";
+        }
+        for (int stop : plan.unserved)
+        {
+            std::cout << "Bin " << stopBinIds[stop] << " could not be scheduled.\n";
+        }
+        for (int binId : skippedBinIds)
+        {
+            std::cout << "Bin " << binId << " is not at a known collection point.\n";
+        }
+        std::cout << "Total distance: " << plan.totalDistance << "\n";
+    }
+};
+
+#endif
@@ -0,0 +1,341 @@
+// smartcity/Carbon_footprint.h
+// Carbon Footprint Estimator: emissions per route and city.
+#ifndef SMARTCITY_CARBON_FOOTPRINT_H
+#define SMARTCITY_CARBON_FOOTPRINT_H
+
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+
+const int MAX_CITIES = 100;
+const double NO_PATH = -1;
+
+struct Edge_Carbon
+{
+    std::string source;
+    std::string target;
+    double weight;
+    double carbonEmission;
+};
+
+struct CityEmission
+{
+    std::string cityName;
+    double totalEmission;
+};
+
+class Carbon_Footprint
+{
+private:
+    int nodes;
+    bool isInitialized;
+    std::string cityNames[MAX_CITIES];
+    int adjacencyList[MAX_CITIES][MAX_CITIES];
+    std::vector<Edge_Carbon> edges;
+    std::vector<CityEmission> cityEmissions;
+    WalStore store; // "cities" and one "route:<walKey(i)>" per edge, which are never removed
+
+    static std::string encodeEdge(const Edge_Carbon &edge)
+    {
+        return RecordWriter().putString(edge.source).putString(edge.target).putDouble(edge.weight)
+            .putDouble(edge.carbonEmission).str();
+    }
+
+    std::string encodeCities() const
+    {
+        RecordWriter out;
+        out.putInt(nodes);
+        for (int i = 0; i < nodes; i++)
+        {
+            out.putString(cityNames[i]);
+        }
+        return out.str();
+    }
+
+    void saveSystemState(WalStore::SnapshotWriter &out) const
+    {
+        if (!isInitialized)
+            return;
+        out.put("cities", encodeCities());
+        for (size_t i = 0; i < edges.size(); i++)
+        {
+            out.put("route:" + walKey(i), encodeEdge(edges[i]));
+        }
+    }
+
+    void setCities(const std::vector<std::string> &cities)
+    {
+        nodes = cities.size();
+        for (int i = 0; i < nodes; i++)
+        {
+            cityNames[i] = cities[i];
+            cityEmissions.push_back({cities[i], 0.0});
+        }
+        isInitialized = true;
+    }
+
+    // False if either city is unknown
+    bool restoreRoute(const Edge_Carbon &edge)
+    {
+        int srcIndex = getCityIndex(edge.source);
+        int tgtIndex = getCityIndex(edge.target);
+        if (srcIndex == -1 || tgtIndex == -1)
+            return false;
+
+        edges.push_back(edge);
+        adjacencyList[srcIndex][tgtIndex] = 1;
+
+        cityEmissions[srcIndex].totalEmission += edge.carbonEmission;
+        cityEmissions[tgtIndex].totalEmission += edge.carbonEmission;
+        return true;
+    }
+
+    void loadSystemState()
+    {
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importSystemStateFromTextFile();
+            store.compact();
+            return;
+        }
+
+        // "cities" is written before any route, so it replays first
+        for (const auto &record : records)
+        {
+            RecordReader in(record.second);
+            if (record.first == "cities")
+            {
+                std::vector<std::string> cities;
+                for (long long count = in.getInt(); count > 0; count--)
+                {
+                    cities.push_back(in.getString());
+                }
+                setCities(cities);
+            }
+            else
+            {
+                Edge_Carbon edge;
+                edge.source = in.getString();
+                edge.target = in.getString();
+                edge.weight = in.getDouble();
+                edge.carbonEmission = in.getDouble();
+                restoreRoute(edge);
+            }
+        }
+    }
+
+    // One-time migration from the old estimator_state.txt
+    void importSystemStateFromTextFile()
+    {
+        std::ifstream inFile("estimator_state.txt");
+        if (inFile.is_open())
+        {
+            int count;
+            if (!(inFile >> count) || count < 0 || count > MAX_CITIES)
+                return;
+            inFile.ignore();
+            std::vector<std::string> cities(count);
+            for (int i = 0; i < count; i++)
+            {
+                std::getline(inFile, cities[i]);
+            }
+            setCities(cities);
+            Edge_Carbon edge;
+            while (inFile >> edge.source >> edge.target >> edge.weight >> edge.carbonEmission)
+            {
+                restoreRoute(edge);
+            }
+            inFile.close();
+        }
+    }
+
+    double calculateCarbonEmission(double distance, std::string wasteType)
+    {
+        double baseFactor = 2.6;
+        double wasteMultiplier = 1.0;
+        if (wasteType == "Plastic")
+            wasteMultiplier = 1.2;
+        else if (wasteType == "Metal")
+            wasteMultiplier = 1.5;
+        else if (wasteType == "Organic")
+            wasteMultiplier = 0.8;
+        else if (wasteType == "Electronic")
+            wasteMultiplier = 1.7;
+        return distance * baseFactor * wasteMultiplier;
+    }
+
+public:
+    // Setup and every route append to <storeName>.wal; the constructor loads
+    // the snapshot and replays the log tail
+    explicit Carbon_Footprint(const std::string &storeName = "smartcity_carbon")
+        : nodes(0), isInitialized(false),
+          store(storeName, [this](WalStore::SnapshotWriter &out) { saveSystemState(out); })
+    {
+        for (int i = 0; i < MAX_CITIES; i++)
+        {
+            for (int j = 0; j < MAX_CITIES; j++)
+            {
+                adjacencyList[i][j] = -1;
+            }
+        }
+        loadSystemState();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    // Non-interactive setup; false if already initialized or there are too many cities
+    bool initializeSystem(const std::vector<std::string> &cities)
+    {
+        if (isInitialized || cities.size() > (size_t)MAX_CITIES)
+            return false;
+        setCities(cities);
+        store.put("cities", encodeCities());
+        return true;
+    }
+
+    void initializeSystem()
+    {
+        if (!isInitialized)
+        {
+            int count;
+            std::cout << "Enter number of cities: ";
+            std::cin >> count;
+            if (std::cin.fail() || count < 0 || count > MAX_CITIES)
+            {
+                std::cin.clear();
+                std::cin.ignore(INT_MAX, '\n');
+                std::cout << "Number of cities must be between 0 and " << MAX_CITIES << ".\n";
+                return;
+            }
+
+            std::vector<std::string> cities(count);
+            std::cout << "Enter the names of the cities:\n";
+            for (int i = 0; i < count; i++)
+            {
+                std::cout << "City " << i + 1 << ": ";
+                std::cin >> cities[i];
+            }
+            initializeSystem(cities);
+        }
+    }
+
+    // False if either city is unknown
+    bool addRoute(const std::string &source, const std::string &target, double distance, std::string wasteType)
+    {
+        double emission = calculateCarbonEmission(distance, wasteType);
+        if (!restoreRoute({source, target, distance, emission}))
+            return false;
+        store.put("route:" + walKey(edges.size() - 1), encodeEdge(edges.back()));
+        return true;
+    }
+
+    void displayRoutes()
+    {
+        if (edges.empty())
+        {
+            std::cout << "\nNo routes available.\n";
+            return;
+        }
+
+        std::cout << "\nRoute Network:\n";
+        std::cout << "----------------------------------------\n";
+        for (const Edge_Carbon &edge : edges)
+        {
+            std::cout << "Route: " << edge.source << " -> " << edge.target << "\n";
+            std::cout << "Distance: " << edge.weight << " km\n";
+            std::cout << "Carbon Emission: " << edge.carbonEmission << " kg CO2\n";
+            std::cout << "----------------------------------------\n";
+        }
+    }
+
+    void displayEmissionsByCity()
+    {
+        if (cityEmissions.empty())
+        {
+            std::cout << "\nNo emission data available.\n";
+            return;
+        }
+
+        std::sort(cityEmissions.begin(), cityEmissions.end(),
+             [](const CityEmission &a, const CityEmission &b)
+             {
+                 return a.totalEmission > b.totalEmission;
+             });
+
+        std::cout << "\nCarbon Emissions by City (Sorted):\n";
+        std::cout << "----------------------------------------\n";
+        for (const CityEmission &city : cityEmissions)
+        {
+            if (city.totalEmission > 0)
+            {
+                std::cout << "City: " << city.cityName << "\n";
+                std::cout << "Total Emissions: " << city.totalEmission << " kg CO2\n";
+                std::cout << "----------------------------------------\n";
+            }
+        }
+    }
+
+    std::vector<double> calculateShortestPaths(const std::string &startCity)
+    {
+        int startIndex = getCityIndex(startCity);
+        std::vector<double> distances(nodes, NO_PATH);
+        distances[startIndex] = 0;
+
+        for (int i = 0; i < nodes - 1; i++)
+        {
+            for (const Edge_Carbon &edge : edges)
+            {
+                int srcIndex = getCityIndex(edge.source);
+                int tgtIndex = getCityIndex(edge.target);
+                if (distances[srcIndex] != NO_PATH &&
+                    (distances[tgtIndex] == NO_PATH ||
+                     distances[srcIndex] + edge.weight < distances[tgtIndex]))
+                {
+                    distances[tgtIndex] = distances[srcIndex] + edge.weight;
+                }
+            }
+        }
+
+        return distances;
+    }
+
+    int getCityIndex(const std::string &cityName)
+    {
+        for (int i = 0; i < nodes; i++)
+        {
+            if (cityNames[i] == cityName)
+                return i;
+        }
+        return -1;
+    }
+
+    std::string getCityName(int index)
+    {
+        return cityNames[index];
+    }
+
+    int getNumCities()
+    {
+        return nodes;
+    }
+
+    bool isSystemInitialized()
+    {
+        return isInitialized;
+    }
+};
+
+#endif
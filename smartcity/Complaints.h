@@ -0,0 +1,711 @@
+// smartcity/Complaints.h
+// Citizen Complaint and Feedback System: complaint store and keyword priority DFA.
+#ifndef SMARTCITY_COMPLAINTS_H
+#define SMARTCITY_COMPLAINTS_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <queue>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../Parallel_for.h"
+#include "../Write_ahead_log.h"
+#include "Instrumentation.h"
+
+// Struct for Complaint Details
+struct Complaint
+{
+    int priority;
+    std::string citizenName;
+    std::string area;
+    std::string description;
+    std::string status;          // Pending, In Progress, or Resolved
+    std::string resolvedByAdmin; // Admin who resolved the complaint
+
+    bool operator<(const Complaint &other) const
+    {
+        return priority < other.priority; // Higher priority complaints come first
+    }
+};
+
+// Complaint Priority Class
+// Every keyword pattern is compiled once into a single DFA, so classifying a
+// complaint is one case-insensitive pass over its bytes with no allocation.
+class ComplaintPriority
+{
+private:
+    std::map<std::string, int> priorityPatterns;
+
+    // Pattern syntax understood by the compiler: literals, '.', postfix '?'
+    // and '|' alternatives, optionally wrapped in one pair of parentheses
+    struct PatternToken
+    {
+        int charClass; // ANY_CHAR matches everything except a line break
+        bool optional;
+    };
+
+    struct PatternBranch
+    {
+        std::vector<PatternToken> tokens;
+        int priority;
+        int firstPosition; // NFA position before the first token
+    };
+
+    enum
+    {
+        OTHER_CHAR = 0,
+        LINE_BREAK = 1,
+        ANY_CHAR = -1
+    };
+
+    unsigned char charClassOf[256];
+    int charClassCount;
+    int highestPriority;
+    std::vector<int> transitions;   // state * charClassCount + class -> state
+    std::vector<int> statePriority; // best priority matched on reaching a state, 0 if none
+
+    std::vector<PatternBranch> parsePatterns()
+    {
+        memset(charClassOf, OTHER_CHAR, sizeof(charClassOf));
+        charClassOf[(unsigned char)'\n'] = charClassOf[(unsigned char)'\r'] = LINE_BREAK;
+        charClassCount = 2;
+
+        std::vector<PatternBranch> branches;
+        for (const auto &pattern : priorityPatterns)
+        {
+            std::string body = pattern.first;
+            if (body.size() >= 2 && body.front() == '(' && body.back() == ')')
+                body = body.substr(1, body.size() - 2);
+
+            branches.push_back({{}, pattern.second, 0});
+            for (char c : body)
+            {
+                PatternBranch &branch = branches.back();
+                if (c == '|')
+                {
+                    branches.push_back({{}, pattern.second, 0});
+                }
+                else if (c == '?')
+                {
+                    if (branch.tokens.empty())
+                        throw std::invalid_argument("ComplaintPriority: dangling '?' in " + pattern.first);
+                    branch.tokens.back().optional = true;
+                }
+                else if (c == '.')
+                {
+                    branch.tokens.push_back({ANY_CHAR, false});
+                }
+                else if (strchr("()[]{}*+^$\\", c))
+                {
+                    throw std::invalid_argument("ComplaintPriority: unsupported syntax in " + pattern.first);
+                }
+                else
+                {
+                    unsigned char lower = std::tolower((unsigned char)c);
+                    if (charClassOf[lower] == OTHER_CHAR)
+                    {
+                        charClassOf[lower] = charClassCount;
+                        charClassOf[(unsigned char)std::toupper(lower)] = charClassCount;
+                        charClassCount++;
+                    }
+                    branch.tokens.push_back({charClassOf[lower], false});
+                }
+            }
+        }
+        return branches;
+    }
+
+    // Subset construction over the branch NFAs. Every DFA state also contains
+    // the start positions, which makes the automaton search for matches anywhere.
+    void compilePatterns()
+    {
+        std::vector<PatternBranch> branches = parsePatterns();
+
+        std::vector<int> positionBranch, positionToken;
+        highestPriority = 1;
+        for (int b = 0; b < (int)branches.size(); b++)
+        {
+            branches[b].firstPosition = positionBranch.size();
+            for (int t = 0; t <= (int)branches[b].tokens.size(); t++)
+            {
+                positionBranch.push_back(b);
+                positionToken.push_back(t);
+            }
+            highestPriority = std::max(highestPriority, branches[b].priority);
+        }
+
+        // Adds position p plus everything reachable by skipping optional tokens
+        auto addClosure = [&](int p, std::vector<int> &positions)
+        {
+            const PatternBranch &branch = branches[positionBranch[p]];
+            for (int t = positionToken[p];; t++, p++)
+            {
+                positions.push_back(p);
+                if (t == (int)branch.tokens.size() || !branch.tokens[t].optional)
+                    break;
+            }
+        };
+
+        std::vector<int> startPositions;
+        for (const PatternBranch &branch : branches)
+            addClosure(branch.firstPosition, startPositions);
+
+        std::map<std::vector<int>, int> stateIds;
+        std::vector<std::vector<int>> states;
+        auto stateFor = [&](std::vector<int> positions)
+        {
+            std::sort(positions.begin(), positions.end());
+            positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+            auto found = stateIds.find(positions);
+            if (found != stateIds.end())
+                return found->second;
+
+            int id = states.size();
+            int priority = 0;
+            for (int p : positions)
+            {
+                const PatternBranch &branch = branches[positionBranch[p]];
+                if (positionToken[p] == (int)branch.tokens.size())
+                    priority = std::max(priority, branch.priority);
+            }
+            stateIds[positions] = id;
+            states.push_back(positions);
+            statePriority.push_back(priority);
+            return id;
+        };
+
+        transitions.clear();
+        statePriority.clear();
+        stateFor(startPositions);
+        for (size_t s = 0; s < states.size(); s++)
+        {
+            transitions.resize(states.size() * charClassCount);
+            for (int charClass = 0; charClass < charClassCount; charClass++)
+            {
+                std::vector<int> next = startPositions;
+                for (int p : states[s])
+                {
+                    const PatternBranch &branch = branches[positionBranch[p]];
+                    int t = positionToken[p];
+                    if (t == (int)branch.tokens.size())
+                        continue;
+                    int tokenClass = branch.tokens[t].charClass;
+                    if (tokenClass == charClass || (tokenClass == ANY_CHAR && charClass != LINE_BREAK))
+                        addClosure(p + 1, next);
+                }
+                int target = stateFor(next);
+                transitions[s * charClassCount + charClass] = target;
+            }
+        }
+    }
+
+public:
+    ComplaintPriority()
+    {
+        // Priority patterns with weights (higher number = higher priority)
+        priorityPatterns = {
+            // Critical - Priority 5
+            {"(urgent|emergency|critical|immediate|asap|life.?threatening)", 5},
+            {"(security breach|data leak|system.?down|outage)", 5},
+            {"(fraud|theft|stolen|hack)", 5},
+
+            // High - Priority 4
+            {"(payment|billing|charge|refund|money)", 4},
+            {"(error|bug|crash|failure|broken)", 4},
+            {"(account.?locked|cannot.?access|locked.?out)", 4},
+
+            // Medium - Priority 3
+            {"(slow|performance|delay|waiting)", 3},
+            {"(incorrect|wrong|invalid|mistake)", 3},
+            {"(update|upgrade|change|modify)", 3},
+
+            // Low - Priority 2
+            {"(question|help|assistance|support|how.?to)", 2},
+            {"(feature|request|suggestion|enhance)", 2},
+            {"(document|instruction|guide|manual)", 2},
+
+            // Very Low - Priority 1
+            {"(feedback|comment|review)", 1},
+            {"(thank|appreciate|kudos)", 1}};
+        compilePatterns();
+    }
+
+    int getPriority(const std::string &complaintText) const
+    {
+        int maxPriority = 1; // Default priority is 1 (Very Low)
+        int state = 0;
+        for (unsigned char c : complaintText)
+        {
+            state = transitions[state * charClassCount + charClassOf[c]];
+            if (statePriority[state] > maxPriority)
+            {
+                maxPriority = statePriority[state];
+                if (maxPriority == highestPriority)
+                    break;
+            }
+        }
+        return maxPriority;
+    }
+
+    // Classifies a whole batch, spreading fixed-size chunks across all cores
+    std::vector<int> classify(const std::vector<std::string> &complaintTexts, unsigned threadCount = 0) const
+    {
+        static Histogram &batchTime = metrics().histogram("complaints.classify_batch");
+        static Counter &classified = metrics().counter("complaints.classified");
+        ScopedTimer timer(batchTime);
+        countEvent(classified, complaintTexts.size());
+
+        const int chunkSize = 4096;
+        std::vector<int> priorities(complaintTexts.size());
+        int chunks = (complaintTexts.size() + chunkSize - 1) / chunkSize;
+        parallelFor(chunks, [&](int chunk)
+        {
+            size_t end = std::min(complaintTexts.size(), (size_t)(chunk + 1) * chunkSize);
+            for (size_t i = (size_t)chunk * chunkSize; i < end; i++)
+                priorities[i] = getPriority(complaintTexts[i]);
+        }, threadCount);
+        return priorities;
+    }
+
+    // Original implementation: one std::regex per pattern, rebuilt on every call.
+    // Kept as the reference for --bench-complaints.
+    int getPriorityWithRegex(const std::string &complaintText) const
+    {
+        std::string text = complaintText;
+        std::transform(text.begin(), text.end(), text.begin(), ::tolower);
+
+        int maxPriority = 1;
+        for (const auto &pattern : priorityPatterns)
+        {
+            if (std::regex_search(text, std::regex(pattern.first)))
+            {
+                maxPriority = std::max(maxPriority, pattern.second);
+            }
+        }
+        return maxPriority;
+    }
+};
+
+// One entry of a bulk complaint import
+struct ComplaintSubmission
+{
+    std::string citizenName;
+    std::string area;
+    std::string description;
+};
+
+// Complaint System Class
+class ComplaintSystem
+{
+private:
+    std::map<std::string, std::priority_queue<Complaint>> areaComplaints; // Categorized by area
+    std::map<std::string, std::string> userComplaints;                    // Track user complaints
+    std::vector<Complaint> resolvedComplaints;                  // Resolved complaints for stats
+    std::map<std::string, int> adminResolvedCount;                   // Track number of complaints resolved by each admin
+    int totalComplaintsSubmitted;
+    int totalComplaintsResolved;
+    WalStore store; // keys: "stats", "admin:<name>", "complaint:<citizen>"
+
+    bool validateArea(const std::string &area)
+    {
+        if (areaComplaints.find(area) == areaComplaints.end() || areaComplaints[area].empty())
+        {
+            std::cout << "\nInvalid area or no complaints in the area.\n";
+            return false;
+        }
+        return true;
+    }
+
+    void displayComplaint(const Complaint &complaint)
+    {
+        std::cout << "\n----------------------------------------\n";
+        std::cout << "Priority: " << complaint.priority << "\n"
+             << "Citizen: " << complaint.citizenName << "\n"
+             << "Area: " << complaint.area << "\n"
+             << "Status: " << complaint.status << "\n"
+             << "Description: " << complaint.description << "\n";
+        if (complaint.status == "Resolved")
+        {
+            std::cout << "Resolved by Admin: " << complaint.resolvedByAdmin << "\n";
+        }
+        std::cout << "----------------------------------------\n";
+    }
+
+    static std::string encodeComplaint(const Complaint &complaint)
+    {
+        return RecordWriter().putInt(complaint.priority).putString(complaint.citizenName).putString(complaint.area)
+            .putString(complaint.description).putString(complaint.status).putString(complaint.resolvedByAdmin).str();
+    }
+
+    void saveComplaint(const Complaint &complaint)
+    {
+        store.put("complaint:" + complaint.citizenName, encodeComplaint(complaint));
+    }
+
+    void saveStats()
+    {
+        store.put("stats", RecordWriter().putInt(totalComplaintsSubmitted).putInt(totalComplaintsResolved).str());
+    }
+
+    // Open complaints only: resolved ones live on in the counters, as they did in complaints.txt
+    void saveComplaintsToFile(WalStore::SnapshotWriter &out) const
+    {
+        static Histogram &saveTime = metrics().histogram("storage.complaints.save");
+        ScopedTimer timer(saveTime);
+
+        out.put("stats", RecordWriter().putInt(totalComplaintsSubmitted).putInt(totalComplaintsResolved).str());
+        for (const auto &entry : adminResolvedCount)
+        {
+            out.put("admin:" + entry.first, RecordWriter().putInt(entry.second).str());
+        }
+        for (const auto &entry : areaComplaints)
+        {
+            std::priority_queue<Complaint> tempQueue = entry.second;
+            while (!tempQueue.empty())
+            {
+                out.put("complaint:" + tempQueue.top().citizenName, encodeComplaint(tempQueue.top()));
+                tempQueue.pop();
+            }
+        }
+    }
+
+    void restoreComplaint(const Complaint &complaint)
+    {
+        if (complaint.status == "Resolved")
+        {
+            resolvedComplaints.push_back(complaint);
+        }
+        else
+        {
+            areaComplaints[complaint.area].push(complaint);
+            userComplaints[complaint.citizenName] = complaint.area;
+        }
+    }
+
+    void loadComplaintsFromFile()
+    {
+        static Histogram &loadTime = metrics().histogram("storage.complaints.load");
+        ScopedTimer timer(loadTime);
+
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importComplaintsFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records)
+        {
+            RecordReader in(record.second);
+            if (record.first == "stats")
+            {
+                totalComplaintsSubmitted = in.getInt();
+                totalComplaintsResolved = in.getInt();
+            }
+            else if (record.first.compare(0, 6, "admin:") == 0)
+            {
+                adminResolvedCount[record.first.substr(6)] = in.getInt();
+            }
+            else
+            {
+                Complaint complaint;
+                complaint.priority = in.getInt();
+                complaint.citizenName = in.getString();
+                complaint.area = in.getString();
+                complaint.description = in.getString();
+                complaint.status = in.getString();
+                complaint.resolvedByAdmin = in.getString();
+                restoreComplaint(complaint);
+            }
+        }
+    }
+
+    // One-time migration from the old complaints.txt / admin_resolved.txt
+    void importComplaintsFromTextFile()
+    {
+        std::ifstream inFile("complaints.txt");
+        if (inFile.is_open())
+        {
+            inFile >> totalComplaintsSubmitted >> totalComplaintsResolved;
+            inFile.ignore();
+            while (!inFile.eof())
+            {
+                Complaint complaint;
+                inFile >> complaint.priority;
+                inFile.ignore();
+                std::getline(inFile, complaint.citizenName, ' ');
+                std::getline(inFile, complaint.area, ' ');
+                std::getline(inFile, complaint.description, ' ');
+                std::getline(inFile, complaint.status, ' ');
+                std::getline(inFile, complaint.resolvedByAdmin);
+                if (!inFile.fail())
+                {
+                    restoreComplaint(complaint);
+                }
+            }
+            inFile.close();
+        }
+
+        std::ifstream adminInFile("admin_resolved.txt");
+        if (adminInFile.is_open())
+        {
+            std::string adminName;
+            int resolvedCount;
+            while (adminInFile >> adminName >> resolvedCount)
+            {
+                adminResolvedCount[adminName] = resolvedCount;
+            }
+            adminInFile.close();
+        }
+    }
+
+public:
+    // Every change appends its records to <storeName>.wal; the constructor
+    // loads the snapshot and replays the log tail
+    explicit ComplaintSystem(const std::string &storeName = "smartcity_complaints")
+        : totalComplaintsSubmitted(0), totalComplaintsResolved(0),
+          store(storeName, [this](WalStore::SnapshotWriter &out) { saveComplaintsToFile(out); })
+    {
+        loadComplaintsFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    void viewResolvedComplaints()
+    {
+        std::cout << "\nLast 5 Resolved Complaints:\n";
+        if (resolvedComplaints.empty())
+        {
+            std::cout << "No resolved complaints yet.\n";
+            return;
+        }
+
+        int count = 0;
+        for (auto it = resolvedComplaints.rbegin(); it != resolvedComplaints.rend() && count < 5; ++it, ++count)
+        {
+            displayComplaint(*it);
+        }
+    }
+
+    void submitComplaint(const std::string &citizenName, const std::string &area, std::string description, ComplaintPriority &prioritySystem)
+    {
+        // Convert description to lowercase
+        std::transform(description.begin(), description.end(), description.begin(), ::tolower);
+
+        if (userComplaints.find(citizenName) != userComplaints.end())
+        {
+            std::cout << "\nYou have already registered a complaint. Only one complaint per user is allowed.\n";
+            return;
+        }
+
+        int priority = prioritySystem.getPriority(description);
+        Complaint newComplaint = {priority, citizenName, area, description, "Pending", ""};
+        areaComplaints[area].push(newComplaint);
+        userComplaints[citizenName] = area;
+        totalComplaintsSubmitted++;
+        saveComplaint(newComplaint);
+        saveStats();
+
+        std::cout << "\nComplaint submitted successfully in area: " << area << " with priority: " << priority << "!\n";
+    }
+
+    std::vector<int> classifyComplaints(const std::vector<std::string> &descriptions, const ComplaintPriority &prioritySystem) const
+    {
+        return prioritySystem.classify(descriptions);
+    }
+
+    // Bulk import: descriptions are lowercased and classified in parallel, then
+    // queued in order under the same one-complaint-per-citizen rule as
+    // submitComplaint. Returns how many were accepted.
+    int submitComplaints(const std::vector<ComplaintSubmission> &batch, const ComplaintPriority &prioritySystem)
+    {
+        const int chunkSize = 4096;
+        std::vector<Complaint> prepared(batch.size());
+        int chunks = (batch.size() + chunkSize - 1) / chunkSize;
+        parallelFor(chunks, [&](int chunk)
+        {
+            size_t end = std::min(batch.size(), (size_t)(chunk + 1) * chunkSize);
+            for (size_t i = (size_t)chunk * chunkSize; i < end; i++)
+            {
+                Complaint &complaint = prepared[i];
+                complaint = {0, batch[i].citizenName, batch[i].area, batch[i].description, "Pending", ""};
+                std::transform(complaint.description.begin(), complaint.description.end(), complaint.description.begin(), ::tolower);
+                complaint.priority = prioritySystem.getPriority(complaint.description);
+            }
+        });
+
+        static Counter &submitted = metrics().counter("complaints.submitted");
+        int accepted = 0;
+        for (Complaint &complaint : prepared)
+        {
+            if (!userComplaints.emplace(complaint.citizenName, complaint.area).second)
+                continue;
+            saveComplaint(complaint);
+            areaComplaints[complaint.area].push(std::move(complaint));
+            accepted++;
+        }
+        totalComplaintsSubmitted += accepted;
+        countEvent(submitted, accepted);
+        if (accepted > 0)
+            saveStats();
+        return accepted;
+    }
+
+    void resolveComplaint(const std::string &area, const std::string &adminName)
+    {
+        if (!validateArea(area))
+            return;
+
+        Complaint topComplaint = areaComplaints[area].top();
+        areaComplaints[area].pop();
+        topComplaint.status = "Resolved";
+        topComplaint.resolvedByAdmin = adminName;
+        resolvedComplaints.push_back(topComplaint);
+        userComplaints.erase(topComplaint.citizenName);
+        totalComplaintsResolved++;
+        adminResolvedCount[adminName]++;
+        store.erase("complaint:" + topComplaint.citizenName);
+        store.put("admin:" + adminName, RecordWriter().putInt(adminResolvedCount[adminName]).str());
+        saveStats();
+
+        std::cout << "\nResolving complaint in area: " << area << ":\n";
+        displayComplaint(topComplaint);
+    }
+
+    void updateComplaintStatus(const std::string &citizenName, const std::string &newStatus)
+    {
+        auto it = userComplaints.find(citizenName);
+        if (it == userComplaints.end())
+        {
+            std::cout << "\nNo complaint found for citizen: " << citizenName << "\n";
+            return;
+        }
+
+        std::string area = it->second;
+        std::priority_queue<Complaint> tempQueue;
+        bool updated = false;
+
+        while (!areaComplaints[area].empty())
+        {
+            Complaint complaint = areaComplaints[area].top();
+            areaComplaints[area].pop();
+
+            if (complaint.citizenName == citizenName)
+            {
+                complaint.status = newStatus;
+                saveComplaint(complaint);
+                updated = true;
+            }
+
+            tempQueue.push(complaint);
+        }
+
+        areaComplaints[area] = tempQueue;
+
+        if (updated)
+        {
+            std::cout << "\nStatus updated successfully for citizen: " << citizenName << "\n";
+        }
+        else
+        {
+            std::cout << "\nFailed to update status.\n";
+        }
+    }
+
+    void viewComplaints(const std::string &area)
+    {
+        if (!validateArea(area))
+            return;
+
+        std::priority_queue<Complaint> tempQueue = areaComplaints[area];
+        std::cout << "\nComplaints in area: " << area << ":\n";
+
+        while (!tempQueue.empty())
+        {
+            Complaint complaint = tempQueue.top();
+            tempQueue.pop();
+            displayComplaint(complaint);
+        }
+    }
+
+    void viewSummary()
+    {
+        std::cout << "\nSystem Summary:\n";
+        std::cout << "----------------------------------------\n";
+        std::cout << "Total Complaints Submitted: " << totalComplaintsSubmitted << "\n";
+        std::cout << "Total Complaints Resolved: " << totalComplaintsResolved << "\n";
+        std::cout << "Pending Complaints: " << totalComplaintsSubmitted - totalComplaintsResolved << "\n";
+        std::cout << "----------------------------------------\n";
+    }
+
+    void viewMonthlyStats()
+    {
+        std::cout << "\nEnd-of-Month Statistics:\n";
+        std::cout << "----------------------------------------\n";
+        std::map<std::string, int> areaStats;
+        for (const auto &complaint : resolvedComplaints)
+        {
+            areaStats[complaint.area]++;
+        }
+
+        std::cout << "Complaints Resolved by Area:\n";
+        for (const auto &entry : areaStats)
+        {
+            std::cout << "Area: " << entry.first << ", Resolved: " << entry.second << "\n";
+        }
+        std::cout << "----------------------------------------\n";
+    }
+
+    void displayAllActiveComplaints()
+    {
+        std::cout << "\nActive Complaints:\n";
+        std::cout << "----------------------------------------\n";
+        bool hasActiveComplaints = false;
+
+        for (const auto &entry : areaComplaints)
+        {
+            const std::string &area = entry.first;
+            const auto &complaints = entry.second;
+
+            if (!complaints.empty())
+            {
+                hasActiveComplaints = true;
+                std::priority_queue<Complaint> tempQueue = complaints;
+                while (!tempQueue.empty())
+                {
+                    const Complaint &complaint = tempQueue.top();
+                    displayComplaint(complaint);
+                    tempQueue.pop();
+                }
+            }
+        }
+
+        if (!hasActiveComplaints)
+        {
+            std::cout << "No active complaints\n";
+        }
+        std::cout << "----------------------------------------\n";
+    }
+
+    // Getter method to access adminResolvedCount
+    const std::map<std::string, int> &getAdminResolvedCount() const
+    {
+        return adminResolvedCount;
+    }
+};
+
+#endif
@@ -0,0 +1,291 @@
+// smartcity/Composting.h
+// Smart Composting System: compost readings and a max-heap per parameter.
+#ifndef SMARTCITY_COMPOSTING_H
+#define SMARTCITY_COMPOSTING_H
+
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+
+//  Structure for compost parameters
+struct CompostData
+{
+    double temperature;
+    double moisture;
+    std::string stage;
+    std::string timeStamp;
+};
+
+// Heap class for parameter monitoring
+class CompostHeap
+{
+private:
+    std::vector<double> heap;
+
+    void heapifyUp(int index)
+    {
+        while (index > 0)
+        {
+            int parent = (index - 1) / 2;
+            if (heap[parent] < heap[index])
+            {
+                std::swap(heap[parent], heap[index]);
+                index = parent;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    void heapifyDown(int index)
+    {
+        int size = heap.size();
+        while (true)
+        {
+            int largest = index;
+            int left = 2 * index + 1;
+            int right = 2 * index + 2;
+
+            if (left < size && heap[left] > heap[largest])
+            {
+                largest = left;
+            }
+            if (right < size && heap[right] > heap[largest])
+            {
+                largest = right;
+            }
+
+            if (largest != index)
+            {
+                std::swap(heap[index], heap[largest]);
+                index = largest;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+public:
+    void insert(double value)
+    {
+        heap.push_back(value);
+        heapifyUp(heap.size() - 1);
+    }
+
+    double getMax()
+    {
+        if (heap.empty())
+            return -1;
+        return heap[0];
+    }
+
+    void removeMax()
+    {
+        if (heap.empty())
+            return;
+        heap[0] = heap.back();
+        heap.pop_back();
+        if (!heap.empty())
+            heapifyDown(0);
+    }
+};
+
+class Smart_Compost_System
+{
+private:
+    std::vector<CompostData> compostHistory;
+    CompostHeap temperatureHeap;
+    CompostHeap moistureHeap;
+    WalStore store; // one record per reading, keyed by walKey(its index in compostHistory)
+
+    static std::string encodeCompostData(const CompostData &data)
+    {
+        return RecordWriter().putDouble(data.temperature).putDouble(data.moisture).putString(data.stage)
+            .putString(data.timeStamp).str();
+    }
+
+    // Readings are never removed, so the index is a stable key
+    void saveCompostDataToFile(WalStore::SnapshotWriter &out) const
+    {
+        for (size_t i = 0; i < compostHistory.size(); i++)
+        {
+            out.put(walKey(i), encodeCompostData(compostHistory[i]));
+        }
+    }
+
+    void restoreCompostData(const CompostData &data)
+    {
+        compostHistory.push_back(data);
+        temperatureHeap.insert(data.temperature);
+        moistureHeap.insert(data.moisture);
+    }
+
+    void loadCompostDataFromFile()
+    {
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importCompostDataFromTextFile();
+            store.compact();
+            return;
+        }
+
+        // open() returns records in first-write order, which is index order here
+        for (const auto &record : records)
+        {
+            RecordReader in(record.second);
+            CompostData data;
+            data.temperature = in.getDouble();
+            data.moisture = in.getDouble();
+            data.stage = in.getString();
+            data.timeStamp = in.getString();
+            restoreCompostData(data);
+        }
+    }
+
+    // One-time migration from the old comma-separated compost_data.txt
+    void importCompostDataFromTextFile()
+    {
+        std::ifstream inFile("compost_data.txt");
+        if (inFile.is_open())
+        {
+            std::string line;
+            while (std::getline(inFile, line))
+            {
+                size_t pos1 = line.find(',');
+                size_t pos2 = line.find(',', pos1 + 1);
+                size_t pos3 = line.find(',', pos2 + 1);
+                double temp = std::stod(line.substr(0, pos1));
+                double moisture = std::stod(line.substr(pos1 + 1, pos2 - pos1 - 1));
+                std::string stage = line.substr(pos2 + 1, pos3 - pos2 - 1);
+                std::string timeStamp = line.substr(pos3 + 1);
+
+                restoreCompostData({temp, moisture, stage, timeStamp});
+            }
+            inFile.close();
+        }
+    }
+
+public:
+    // Every reading appends one record to <storeName>.wal; the constructor
+    // loads the snapshot and replays the log tail
+    explicit Smart_Compost_System(const std::string &storeName = "smartcity_compost")
+        : store(storeName, [this](WalStore::SnapshotWriter &out) { saveCompostDataToFile(out); })
+    {
+        loadCompostDataFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    // Admin Functions
+    void addCompostData(double temp, double moisture, std::string stage)
+    {
+        CompostData data;
+        data.temperature = temp;
+        data.moisture = moisture;
+        data.stage = stage;
+        data.timeStamp = getCurrentTime();
+
+        restoreCompostData(data);
+        store.put(walKey(compostHistory.size() - 1), encodeCompostData(data));
+
+        std::cout << "Data added successfully!\n";
+    }
+
+    void viewAllData()
+    {
+        std::cout << "\nComplete Compost History:\n";
+        std::cout << std::setw(15) << "Temperature" << std::setw(15) << "Moisture"
+             << std::setw(20) << "Stage" << std::setw(25) << "Timestamp\n";
+        std::cout << std::string(75, '-') << "\n";
+
+        for (const auto &data : compostHistory)
+        {
+            std::cout << std::setw(15) << data.temperature
+                 << std::setw(15) << data.moisture
+                 << std::setw(20) << data.stage
+                 << std::setw(25) << data.timeStamp << "\n";
+        }
+    }
+
+    // User Functions
+    void checkCurrentStatus()
+    {
+        if (compostHistory.empty())
+        {
+            std::cout << "No compost data available.\n";
+            return;
+        }
+
+        auto latest = compostHistory.back();
+        std::cout << "\nCurrent Compost Status:\n";
+        std::cout << "Temperature: " << latest.temperature << "°C\n";
+        std::cout << "Moisture: " << latest.moisture << "%\n";
+        std::cout << "Stage: " << latest.stage << "\n";
+
+        // Provide recommendations
+        if (latest.temperature > 65)
+        {
+            std::cout << "Warning: Temperature too high! Consider adding brown materials.\n";
+        }
+        else if (latest.temperature < 45)
+        {
+            std::cout << "Warning: Temperature too low! Consider adding green materials.\n";
+        }
+
+        if (latest.moisture > 60)
+        {
+            std::cout << "Warning: Too wet! Add dry brown materials.\n";
+        }
+        else if (latest.moisture < 40)
+        {
+            std::cout << "Warning: Too dry! Add water or green materials.\n";
+        }
+    }
+
+    void searchStage(std::string stage)
+    {
+        std::cout << "\nSearching for stage: " << stage << "\n";
+        bool found = false;
+
+        for (const auto &data : compostHistory)
+        {
+            if (data.stage == stage)
+            {
+                std::cout << "Found entry:\n";
+                std::cout << "Temperature: " << data.temperature << "°C\n";
+                std::cout << "Moisture: " << data.moisture << "%\n";
+                std::cout << "Timestamp: " << data.timeStamp << "\n\n";
+                found = true;
+            }
+        }
+
+        if (!found)
+        {
+            std::cout << "No entries found for stage: " << stage << "\n";
+        }
+    }
+
+private:
+    std::string getCurrentTime()
+    {
+        time_t now = time(0);
+        std::string dt = ctime(&now);
+        return dt.substr(0, dt.length() - 1);
+    }
+};
+
+#endif
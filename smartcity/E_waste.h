@@ -0,0 +1,636 @@
+// smartcity/E_waste.h
+// E-Waste Management System: collection centers (AVL tree) and routes between them.
+#ifndef SMARTCITY_E_WASTE_H
+#define SMARTCITY_E_WASTE_H
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <queue>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+
+// E-Waste Collection Center Structure
+class CollectionCenter
+{
+public:
+    std::string id;
+    std::string location;
+    float eWasteQuantity; // Changed to float
+
+    CollectionCenter(std::string id, std::string loc, float qty) // Changed parameter type
+        : id(id), location(loc), eWasteQuantity(qty)
+    {
+    }
+};
+
+// AVL Node for Collection Center
+class AVLNode
+{
+public:
+    CollectionCenter center;
+    AVLNode *left;
+    AVLNode *right;
+    int height;
+
+    AVLNode(CollectionCenter c)
+        : center(c), left(nullptr), right(nullptr), height(1) {}
+};
+
+// AVL Tree for Managing Collection Centers
+class AVLTree
+{
+private:
+    AVLNode *root;
+    std::set<std::pair<std::string, std::string>> centerKeys; // To track (ID, Location) pairs
+    WalStore store;                                            // one record per (ID, Location) center
+
+    static std::string recordKey(const std::string &id, const std::string &location)
+    {
+        return id + '\0' + location;
+    }
+
+    static std::string encodeCenter(const CollectionCenter &center)
+    {
+        return RecordWriter().putString(center.id).putString(center.location).putDouble(center.eWasteQuantity).str();
+    }
+
+    void saveCenter(const CollectionCenter &center)
+    {
+        store.put(recordKey(center.id, center.location), encodeCenter(center));
+    }
+
+    // Same search path as insert, so it finds the node addCenter would have merged into
+    AVLNode *findCenter(const std::string &id, const std::string &location)
+    {
+        AVLNode *current = root;
+        while (current)
+        {
+            if (current->center.id == id && current->center.location == location)
+            {
+                return current;
+            }
+            current = (id < current->center.id) ? current->left : current->right;
+        }
+        return nullptr;
+    }
+
+    // Adds a loaded center without logging it again
+    void restoreCenter(const CollectionCenter &center)
+    {
+        if (centerKeys.insert({center.id, center.location}).second)
+        {
+            root = insert(root, center);
+        }
+        else if (AVLNode *existing = findCenter(center.id, center.location))
+        {
+            existing->center.eWasteQuantity += center.eWasteQuantity;
+        }
+    }
+
+    int getHeight(AVLNode *node)
+    {
+        return node ? node->height : 0;
+    }
+
+    int getBalance(AVLNode *node)
+    {
+        return node ? getHeight(node->left) - getHeight(node->right) : 0;
+    }
+
+    AVLNode *rotateRight(AVLNode *y)
+    {
+        AVLNode *x = y->left;
+        AVLNode *T2 = x->right;
+
+        x->right = y;
+        y->left = T2;
+
+        y->height = std::max(getHeight(y->left), getHeight(y->right)) + 1;
+        x->height = std::max(getHeight(x->left), getHeight(x->right)) + 1;
+
+        return x;
+    }
+
+    AVLNode *rotateLeft(AVLNode *x)
+    {
+        AVLNode *y = x->right;
+        AVLNode *T2 = y->left;
+
+        y->left = x;
+        x->right = T2;
+
+        x->height = std::max(getHeight(x->left), getHeight(x->right)) + 1;
+        y->height = std::max(getHeight(y->left), getHeight(y->right)) + 1;
+
+        return y;
+    }
+
+    AVLNode *insert(AVLNode *node, CollectionCenter center)
+    {
+        if (!node)
+        {
+            return new AVLNode(center);
+        }
+
+        if (center.id < node->center.id)
+        {
+            node->left = insert(node->left, center);
+        }
+        else if (center.id > node->center.id || (center.id == node->center.id && center.location != node->center.location))
+        {
+            node->right = insert(node->right, center);
+        }
+        else
+        {
+            return node;
+        }
+
+        node->height = std::max(getHeight(node->left), getHeight(node->right)) + 1;
+
+        int balance = getBalance(node);
+
+        if (balance > 1 && center.id < node->left->center.id)
+        {
+            return rotateRight(node);
+        }
+
+        if (balance < -1 && center.id > node->right->center.id)
+        {
+            return rotateLeft(node);
+        }
+
+        if (balance > 1 && center.id > node->left->center.id)
+        {
+            node->left = rotateLeft(node->left);
+            return rotateRight(node);
+        }
+
+        if (balance < -1 && center.id < node->right->center.id)
+        {
+            node->right = rotateRight(node->right);
+            return rotateLeft(node);
+        }
+
+        return node;
+    }
+
+    AVLNode *getMinValueNode(AVLNode *node)
+    {
+        AVLNode *current = node;
+        while (current && current->left)
+        {
+            current = current->left;
+        }
+        return current;
+    }
+
+    AVLNode *deleteNode(AVLNode *root, std::string id)
+    {
+        if (!root)
+        {
+            return root;
+        }
+
+        if (id < root->center.id)
+        {
+            root->left = deleteNode(root->left, id);
+        }
+        else if (id > root->center.id)
+        {
+            root->right = deleteNode(root->right, id);
+        }
+        else
+        {
+            centerKeys.erase({root->center.id, root->center.location});
+
+            if (!root->left || !root->right)
+            {
+                AVLNode *temp = root->left ? root->left : root->right;
+                if (!temp)
+                {
+                    temp = root;
+                    root = nullptr;
+                }
+                else
+                {
+                    *root = *temp;
+                }
+                delete temp;
+            }
+            else
+            {
+                AVLNode *temp = getMinValueNode(root->right);
+                root->center = temp->center;
+                root->right = deleteNode(root->right, temp->center.id);
+            }
+        }
+
+        if (!root)
+        {
+            return root;
+        }
+
+        root->height = std::max(getHeight(root->left), getHeight(root->right)) + 1;
+        int balance = getBalance(root);
+
+        if (balance > 1 && getBalance(root->left) >= 0)
+        {
+            return rotateRight(root);
+        }
+        if (balance > 1 && getBalance(root->left) < 0)
+        {
+            root->left = rotateLeft(root->left);
+            return rotateRight(root);
+        }
+        if (balance < -1 && getBalance(root->right) <= 0)
+        {
+            return rotateLeft(root);
+        }
+        if (balance < -1 && getBalance(root->right) > 0)
+        {
+            root->right = rotateRight(root->right);
+            return rotateLeft(root);
+        }
+
+        return root;
+    }
+
+    void inOrderTraversal(AVLNode *node)
+    {
+        if (node)
+        {
+            inOrderTraversal(node->left);
+            std::cout << "Center ID: " << node->center.id << ", Location: " << node->center.location
+                 << ", E-Waste Quantity: " << node->center.eWasteQuantity << " kg\n";
+            inOrderTraversal(node->right);
+        }
+    }
+
+public:
+    // Every change appends its record to <storeName>.wal; the constructor
+    // loads the snapshot and replays the log tail
+    explicit AVLTree(const std::string &storeName = "smartcity_centers")
+        : root(nullptr), store(storeName, [this](WalStore::SnapshotWriter &out) { saveCenters(out, root); })
+    {
+        loadCentersFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    bool addCenter(CollectionCenter center)
+    {
+        auto key = std::make_pair(center.id, center.location);
+        if (centerKeys.find(key) != centerKeys.end())
+        {
+            AVLNode *existing = findCenter(center.id, center.location);
+            if (!existing)
+            {
+                return false;
+            }
+            existing->center.eWasteQuantity += center.eWasteQuantity;
+            saveCenter(existing->center);
+            std::cout << "Center ID and Location already exist. Adding E-Waste Quantity.\n";
+            return true;
+        }
+        centerKeys.insert(key);
+        root = insert(root, center);
+        saveCenter(center);
+        std::cout << "Collection Center added successfully.\n";
+        return true;
+    }
+
+    void removeCenter(std::string id)
+    {
+        if (centerKeys.find({id, ""}) == centerKeys.end())
+        {
+            std::cout << "Error: Center ID does not exist.\n";
+            return;
+        }
+        // deleteNode removes the first node with this ID on the search path
+        AVLNode *current = root;
+        while (current && current->center.id != id)
+        {
+            current = (id < current->center.id) ? current->left : current->right;
+        }
+        if (!current)
+        {
+            return;
+        }
+        std::string location = current->center.location;
+        root = deleteNode(root, id);
+        store.erase(recordKey(id, location));
+    }
+
+    void displayCenters()
+    {
+        if (!root)
+        {
+            std::cout << "No collection centers available.\n";
+            return;
+        }
+        inOrderTraversal(root);
+    }
+
+    bool modifyCenter(std::string id, std::string newLocation, float newQuantity)
+    {
+        AVLNode *current = root;
+        while (current)
+        {
+            if (current->center.id == id)
+            {
+                std::string previousLocation = current->center.location;
+                current->center.location = newLocation;
+                current->center.eWasteQuantity = newQuantity;
+                if (previousLocation != newLocation)
+                {
+                    store.erase(recordKey(id, previousLocation));
+                }
+                saveCenter(current->center);
+                std::cout << "Collection center details updated successfully.\n";
+                return true;
+            }
+            current = (id < current->center.id) ? current->left : current->right;
+        }
+        std::cout << "Error: Collection center not found.\n";
+        return false;
+    }
+
+    void loadCentersFromFile()
+    {
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importCentersFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records)
+        {
+            RecordReader in(record.second);
+            std::string id = in.getString();
+            std::string location = in.getString();
+            float quantity = in.getDouble();
+            restoreCenter(CollectionCenter(id, location, quantity));
+        }
+    }
+
+private:
+    // One-time migration from the old space-delimited centers.txt
+    void importCentersFromTextFile()
+    {
+        std::ifstream inFile("centers.txt");
+        if (inFile.is_open())
+        {
+            std::string id, location;
+            float quantity;
+            while (inFile >> id >> location >> quantity)
+            {
+                restoreCenter(CollectionCenter(id, location, quantity));
+            }
+            inFile.close();
+        }
+    }
+
+    void saveCenters(WalStore::SnapshotWriter &out, AVLNode *node) const
+    {
+        if (node)
+        {
+            saveCenters(out, node->left);
+            out.put(recordKey(node->center.id, node->center.location), encodeCenter(node->center));
+            saveCenters(out, node->right);
+        }
+    }
+};
+
+// Graph for Routes between Centers
+class Graph_E_Waste
+{
+private:
+    std::map<std::string, std::vector<std::pair<std::string, double>>> adjList;
+    std::map<std::string, std::string> locationMap; // Maps ID to Location
+    WalStore store;                                 // "route:<id>" adjacency lists and "location:<id>" names
+
+    static std::string encodeRoutes(const std::vector<std::pair<std::string, double>> &routes)
+    {
+        RecordWriter out;
+        out.putInt(routes.size());
+        for (const auto &neighbor : routes)
+        {
+            out.putString(neighbor.first).putDouble(neighbor.second);
+        }
+        return out.str();
+    }
+
+    void saveRoutes(const std::string &id)
+    {
+        store.put("route:" + id, encodeRoutes(adjList[id]));
+    }
+
+    void saveRoutesToFile(WalStore::SnapshotWriter &out) const
+    {
+        for (const auto &node : adjList)
+        {
+            out.put("route:" + node.first, encodeRoutes(node.second));
+        }
+        for (const auto &location : locationMap)
+        {
+            out.put("location:" + location.first, location.second);
+        }
+    }
+
+    void loadRoutesFromFile()
+    {
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importRoutesFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records)
+        {
+            const std::string &key = record.first;
+            if (key.compare(0, 9, "location:") == 0)
+            {
+                locationMap[key.substr(9)] = record.second;
+            }
+            else if (key.compare(0, 6, "route:") == 0)
+            {
+                RecordReader in(record.second);
+                std::vector<std::pair<std::string, double>> &routes = adjList[key.substr(6)];
+                routes.clear();
+                for (long long count = in.getInt(); count > 0; count--)
+                {
+                    std::string neighbor = in.getString();
+                    routes.push_back({neighbor, in.getDouble()});
+                }
+            }
+        }
+    }
+
+    // One-time migration from the old routes.txt, which lists every route
+    // once per direction
+    void importRoutesFromTextFile()
+    {
+        std::ifstream inFile("routes.txt");
+        if (inFile.is_open())
+        {
+            std::string u, v;
+            double weight;
+            while (inFile >> u >> v >> weight)
+            {
+                adjList[u].push_back({v, weight});
+            }
+            inFile.close();
+        }
+    }
+
+public:
+    // Every change appends its records to <storeName>.wal; the constructor
+    // loads the snapshot and replays the log tail
+    explicit Graph_E_Waste(const std::string &storeName = "smartcity_routes")
+        : store(storeName, [this](WalStore::SnapshotWriter &out) { saveRoutesToFile(out); })
+    {
+        loadRoutesFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    void addEdge(std::string u, std::string v, double weight)
+    {
+        if (u == v)
+        {
+            return; // Ignore routes where the two centers are the same
+        }
+        adjList[u].push_back({v, weight});
+        adjList[v].push_back({u, weight});
+        saveRoutes(u);
+        saveRoutes(v);
+    }
+
+    void displayGraph_E_Waste()
+    {
+        for (const auto &node : adjList)
+        {
+            std::cout << "Location " << locationMap[node.first] << " is connected to:\n";
+            for (const auto &neighbor : node.second)
+            {
+                std::cout << "  -> " << locationMap[neighbor.first] << " (Distance: " << neighbor.second << " km)\n";
+            }
+        }
+    }
+
+    void shortestPath(std::string start, std::string end)
+    {
+        std::map<std::string, double> dist;
+        std::map<std::string, std::string> parent;
+        typedef std::pair<double, std::string> HeapEntry; // (distance, center)
+        std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+
+        for (auto &node : adjList)
+        {
+            dist[node.first] = std::numeric_limits<double>::max();
+        }
+        dist[start] = 0;
+        heap.push({0, start});
+
+        while (!heap.empty())
+        {
+            HeapEntry top = heap.top();
+            heap.pop();
+            if (top.first > dist[top.second])
+                continue; // stale entry
+            if (top.second == end)
+                break;
+
+            for (auto &neighbor : adjList[top.second])
+            {
+                if (top.first + neighbor.second < dist[neighbor.first])
+                {
+                    dist[neighbor.first] = top.first + neighbor.second;
+                    parent[neighbor.first] = top.second;
+                    heap.push({dist[neighbor.first], neighbor.first});
+                }
+            }
+        }
+
+        if (dist[end] == std::numeric_limits<double>::max())
+        {
+            std::cout << "No path exists from " << locationMap[start] << " to " << locationMap[end] << ".\n";
+            return;
+        }
+
+        std::cout << "Shortest path from " << locationMap[start] << " to " << locationMap[end] << ": ";
+        std::string current = end;
+        std::vector<std::string> path;
+        while (current != start)
+        {
+            path.push_back(current);
+            current = parent[current];
+        }
+        path.push_back(start);
+        std::reverse(path.begin(), path.end());
+        for (const auto &node : path)
+        {
+            std::cout << locationMap[node] << " ";
+        }
+        std::cout << "\nTotal Distance: " << dist[end] << " km\n";
+    }
+
+    void modifyRoute(std::string u, std::string v, double newWeight)
+    {
+        bool routeFound = false;
+        for (auto &neighbor : adjList[u])
+        {
+            if (neighbor.first == v)
+            {
+                neighbor.second = newWeight;
+                routeFound = true;
+                break;
+            }
+        }
+        for (auto &neighbor : adjList[v])
+        {
+            if (neighbor.first == u)
+            {
+                neighbor.second = newWeight;
+                break;
+            }
+        }
+        if (routeFound)
+        {
+            std::cout << "Route between " << locationMap[u] << " and " << locationMap[v] << " updated successfully.\n";
+            saveRoutes(u);
+            saveRoutes(v);
+        }
+        else
+        {
+            std::cout << "Error: Route not found.\n";
+        }
+    }
+
+    void addLocation(std::string id, std::string location)
+    {
+        locationMap[id] = location;
+        store.put("location:" + id, location);
+    }
+};
+
+#endif
@@ -0,0 +1,225 @@
+// smartcity/Event_planner.h
+// Zero Waste Event Planner: per-event waste forecasts by type.
+#ifndef SMARTCITY_EVENT_PLANNER_H
+#define SMARTCITY_EVENT_PLANNER_H
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+
+struct WasteFactors
+{
+    double baseRate;
+    double scaleFactor;
+    int attendeeImpact;
+    double durationImpact;
+};
+
+struct Event
+{
+    std::string name;
+    float duration;
+    std::string type;
+    int attendees;
+    double wasteForecast;
+
+    Event(std::string n, float d, std::string t, int a, double w)
+        : name(n), duration(d), type(t), attendees(a), wasteForecast(w) {}
+};
+
+class Zero_Waste_Event_Planner
+{
+private:
+    std::unordered_map<std::string, std::vector<std::string>> wasteCategories;
+    std::unordered_map<std::string, WasteFactors> eventWasteFactors;
+    std::vector<Event> events;
+    WalStore store; // one record per event, keyed by walKey(its index in events)
+
+    double calculateWasteForecast(float duration, const std::string &type, int attendees)
+    {
+        WasteFactors factors = eventWasteFactors[type];
+
+        double baseWaste = factors.baseRate * attendees * duration;
+        double scaledWaste = baseWaste * factors.scaleFactor;
+        double attendeeScaling = 1.0 + (std::log10(attendees) * factors.attendeeImpact / 1000.0);
+        double durationFactor = 1.0 + (factors.durationImpact * std::log10(duration + 1));
+        double totalWaste = scaledWaste * attendeeScaling * durationFactor;
+
+        return std::round(totalWaste * 100) / 100;
+    }
+
+    static std::string encodeEvent(const Event &event)
+    {
+        return RecordWriter().putString(event.name).putDouble(event.duration).putString(event.type)
+            .putInt(event.attendees).putDouble(event.wasteForecast).str();
+    }
+
+    // Events are never removed, so the index is a stable key
+    void saveEventsToFile(WalStore::SnapshotWriter &out) const
+    {
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            out.put(walKey(i), encodeEvent(events[i]));
+        }
+    }
+
+    void loadEventsFromFile()
+    {
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importEventsFromTextFile();
+            store.compact();
+            return;
+        }
+
+        // open() returns records in first-write order, which is index order here
+        for (const auto &record : records)
+        {
+            RecordReader in(record.second);
+            std::string name = in.getString();
+            float duration = in.getDouble();
+            std::string type = in.getString();
+            int attendees = in.getInt();
+            double wasteForecast = in.getDouble();
+            events.emplace_back(name, duration, type, attendees, wasteForecast);
+        }
+    }
+
+    // One-time migration from the old comma-separated events.txt
+    void importEventsFromTextFile()
+    {
+        std::ifstream inFile("events.txt");
+        if (inFile.is_open())
+        {
+            std::string line;
+            while (std::getline(inFile, line))
+            {
+                size_t pos1 = line.find(',');
+                size_t pos2 = line.find(',', pos1 + 1);
+                size_t pos3 = line.find(',', pos2 + 1);
+                size_t pos4 = line.find(',', pos3 + 1);
+
+                std::string name = line.substr(0, pos1);
+                float duration = std::stof(line.substr(pos1 + 1, pos2 - pos1 - 1));
+                std::string type = line.substr(pos2 + 1, pos3 - pos2 - 1);
+                int attendees = std::stoi(line.substr(pos3 + 1, pos4 - pos3 - 1));
+                double wasteForecast = std::stod(line.substr(pos4 + 1));
+
+                events.emplace_back(name, duration, type, attendees, wasteForecast);
+            }
+            inFile.close();
+        }
+    }
+
+public:
+    // Every planned event appends one record to <storeName>.wal; the
+    // constructor loads the snapshot and replays the log tail
+    explicit Zero_Waste_Event_Planner(const std::string &storeName = "smartcity_events")
+        : store(storeName, [this](WalStore::SnapshotWriter &out) { saveEventsToFile(out); })
+    {
+        wasteCategories["Conference"] = {"Paper", "Plastic", "Electronic"};
+        wasteCategories["Festival"] = {"Food", "Plastic", "Glass", "Decorations"};
+        wasteCategories["Sports"] = {"Food", "Plastic", "Metal Cans"};
+        wasteCategories["Concert"] = {"Paper", "Plastic", "Batteries"};
+        wasteCategories["Exhibition"] = {"Paper", "Plastic", "Glass", "Electronics"};
+        wasteCategories["Seminar"] = {"Paper", "Plastic", "Electronic"};
+
+        eventWasteFactors["Conference"] = {0.15, 1.0, 5, 0.8};
+        eventWasteFactors["Festival"] = {0.25, 1.2, 8, 0.9};
+        eventWasteFactors["Sports"] = {0.18, 0.9, 6, 0.7};
+        eventWasteFactors["Concert"] = {0.22, 1.1, 7, 0.85};
+        eventWasteFactors["Exhibition"] = {0.20, 1.0, 6, 0.8};
+        eventWasteFactors["Seminar"] = {0.12, 0.8, 4, 0.75};
+
+        loadEventsFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    void planEvent(const std::string &name, float duration, std::string type, int attendees)
+    {
+        std::transform(type.begin(), type.end(), type.begin(), ::tolower);
+        if (!type.empty())
+        {
+            type[0] = std::toupper(type[0]);
+        }
+
+        if (wasteCategories.find(type) == wasteCategories.end())
+        {
+            std::cout << "Invalid event type. Please choose a valid type.\n";
+            return;
+        }
+
+        double wasteForecast = calculateWasteForecast(duration, type, attendees);
+        events.emplace_back(name, duration, type, attendees, wasteForecast);
+        store.put(walKey(events.size() - 1), encodeEvent(events.back()));
+
+        std::cout << "\nPlanned Event: " << name << "\n";
+        std::cout << "  Type: " << type << "\n";
+        std::cout << "  Duration: " << std::fixed << std::setprecision(1) << duration << " hours\n";
+        std::cout << "  Attendees: " << attendees << "\n";
+        std::cout << "  Waste Forecast: " << std::fixed << std::setprecision(2) << wasteForecast << " kg\n";
+        std::cout << "  Waste Categories: ";
+        for (const auto &category : wasteCategories[type])
+        {
+            std::cout << category << " ";
+        }
+        std::cout << "\n";
+    }
+
+    void displayEvents()
+    {
+        if (events.empty())
+        {
+            std::cout << "\nNo events planned yet.\n";
+            return;
+        }
+
+        std::cout << "\nPlanned Events:\n";
+        for (const auto &event : events)
+        {
+            std::cout << "  Name: " << event.name << "\n"
+                 << "    Duration: " << std::fixed << std::setprecision(1) << event.duration << " hours\n"
+                 << "    Type: " << event.type << "\n"
+                 << "    Attendees: " << event.attendees << "\n"
+                 << "    Waste Forecast: " << std::fixed << std::setprecision(2) << event.wasteForecast << " kg\n";
+        }
+    }
+
+    void displayWasteBreakdown()
+    {
+        if (events.empty())
+        {
+            std::cout << "\nNo events to calculate waste breakdown.\n";
+            return;
+        }
+
+        std::cout << "\nWaste Breakdown:\n";
+        for (const auto &event : events)
+        {
+            std::cout << "Event: " << event.name << "\n";
+            double categoryWaste = event.wasteForecast / wasteCategories[event.type].size();
+            for (const auto &category : wasteCategories[event.type])
+            {
+                std::cout << "  " << category << " Waste: " << std::fixed << std::setprecision(2)
+                     << categoryWaste << " kg\n";
+            }
+            std::cout << "\n";
+        }
+    }
+};
+
+#endif
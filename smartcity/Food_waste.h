@@ -0,0 +1,262 @@
+// smartcity/Food_waste.h
+// Food Waste Management System: food donations by location.
+#ifndef SMARTCITY_FOOD_WASTE_H
+#define SMARTCITY_FOOD_WASTE_H
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+#include "Instrumentation.h"
+
+// Function to convert a string to lowercase
+inline std::string to_lowercasee(const std::string &input)
+{
+    std::string lowerStr = input;
+    std::transform(lowerStr.begin(), lowerStr.end(), lowerStr.begin(), ::tolower);
+    return lowerStr;
+}
+
+// Structure to represent a food donation
+struct FoodDonation
+{
+    std::string donorName;
+    std::string location;
+    std::string foodType;
+    int quantity;
+    std::string status;
+    long long key = -1; // record key in the management system's log
+
+    FoodDonation(const std::string &donorName, const std::string &location, const std::string &foodType, int quantity, const std::string &status)
+        : donorName(donorName), location(location), foodType(foodType), quantity(quantity), status(status) {}
+};
+
+// Function to log actions
+inline void log_Action(const std::string &action)
+{
+    std::ofstream logFile("food_waste_log.txt", std::ios::app);
+    if (logFile.is_open())
+    {
+        time_t now = time(nullptr);
+        logFile << ctime(&now) << " - " << action << "\n";
+        logFile.close();
+    }
+}
+
+// Class to manage food waste donations
+class FoodWasteManagementSystem
+{
+private:
+    std::string legacyFile;
+    std::vector<FoodDonation> donations;
+    WalStore store;            // one record per donation, keyed by walKey(donation.key)
+    long long nextDonationKey; // only grows, so a deleted donation's key is never reused
+
+    static std::string encodeDonation(const FoodDonation &donation)
+    {
+        return RecordWriter().putString(donation.donorName).putString(donation.location).putString(donation.foodType)
+            .putInt(donation.quantity).putString(donation.status).str();
+    }
+
+    void saveDonationsToFile(WalStore::SnapshotWriter &out) const
+    {
+        static Histogram &saveTime = metrics().histogram("storage.donations.save");
+        ScopedTimer timer(saveTime);
+
+        for (const auto &donation : donations)
+        {
+            out.put(walKey(donation.key), encodeDonation(donation));
+        }
+    }
+
+    void loadDonationsFromFile()
+    {
+        static Histogram &loadTime = metrics().histogram("storage.donations.load");
+        ScopedTimer timer(loadTime);
+
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importDonationsFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records)
+        {
+            RecordReader in(record.second);
+            std::string donorName = in.getString();
+            std::string location = in.getString();
+            std::string foodType = in.getString();
+            int quantity = in.getInt();
+            std::string status = in.getString();
+            donations.emplace_back(donorName, location, foodType, quantity, status);
+            donations.back().key = std::stoll(record.first);
+            nextDonationKey = std::max(nextDonationKey, donations.back().key + 1);
+        }
+    }
+
+    // One-time migration from the old comma-separated food_donations.txt
+    void importDonationsFromTextFile()
+    {
+        std::ifstream inFile(legacyFile);
+        if (inFile.is_open())
+        {
+            std::string line;
+            while (std::getline(inFile, line))
+            {
+                std::istringstream iss(line);
+                std::string donorName, location, foodType, status, quantityStr;
+                int quantity;
+
+                std::getline(iss, donorName, ',');
+                std::getline(iss, location, ',');
+                std::getline(iss, foodType, ',');
+                std::getline(iss, quantityStr, ',');
+                std::getline(iss, status, ',');
+
+                quantity = std::stoi(quantityStr);
+                donations.emplace_back(to_lowercasee(donorName), to_lowercasee(location), to_lowercasee(foodType), quantity, to_lowercasee(status));
+                donations.back().key = nextDonationKey++;
+            }
+            inFile.close();
+        }
+    }
+
+public:
+    // Every add or delete appends to <storeName>.wal; the constructor loads the
+    // snapshot and replays the log tail
+    explicit FoodWasteManagementSystem(const std::string &storeName = "smartcity_donations",
+                                       const std::string &legacyFile = "food_donations.txt")
+        : legacyFile(legacyFile),
+          store(storeName, [this](WalStore::SnapshotWriter &out) { saveDonationsToFile(out); }), nextDonationKey(0)
+    {
+        loadDonationsFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    void addFoodDonation(const std::string &donorName, const std::string &location, const std::string &foodType, int quantity, const std::string &status)
+    {
+        donations.emplace_back(to_lowercasee(donorName), to_lowercasee(location), to_lowercasee(foodType), quantity, to_lowercasee(status));
+        donations.back().key = nextDonationKey++;
+        store.put(walKey(donations.back().key), encodeDonation(donations.back()));
+        log_Action("Added food donation from " + donorName + " located at " + location);
+        std::cout << "Donation added successfully!\n";
+    }
+
+    void deleteFoodDonation(const std::string &donorName, const std::string &location)
+    {
+        // stable_partition rather than remove_if: the removed donations stay
+        // intact past `it`, so their keys can still be read
+        auto it = std::stable_partition(donations.begin(), donations.end(), [&](const FoodDonation &donation)
+                            { return !(donation.donorName == to_lowercasee(donorName) && donation.location == to_lowercasee(location)); });
+
+        if (it != donations.end())
+        {
+            log_Action("Deleted food donation from " + donorName + " located at " + location);
+            std::vector<long long> removedKeys;
+            for (auto removed = it; removed != donations.end(); ++removed)
+            {
+                removedKeys.push_back(removed->key);
+            }
+            donations.erase(it, donations.end());
+            for (long long key : removedKeys)
+            {
+                store.erase(walKey(key));
+            }
+            std::cout << "Donation deleted successfully!\n";
+        }
+        else
+        {
+            std::cout << "No matching donation found to delete.\n";
+        }
+    }
+
+    std::vector<FoodDonation> findDonationsByLocation(const std::string &location) const
+    {
+        static Histogram &searchTime = metrics().histogram("search.donations_by_location");
+        ScopedTimer timer(searchTime);
+
+        std::vector<FoodDonation> result;
+        std::string searchLocation = to_lowercasee(location);
+        for (const auto &donation : donations)
+        {
+            if (donation.location == searchLocation)
+            {
+                result.push_back(donation);
+            }
+        }
+        return result;
+    }
+
+    void searchFoodDonationByLocation(const std::string &location)
+    {
+        std::vector<FoodDonation> result = findDonationsByLocation(location);
+        if (result.empty())
+        {
+            std::cout << "No donations found in the specified location.\n";
+        }
+        else
+        {
+            std::cout << "Donations in location " << location << ":\n";
+            for (const auto &donation : result)
+            {
+                std::cout << "Donor Name: " << donation.donorName
+                     << ", Food Type: " << donation.foodType
+                     << ", Quantity: " << donation.quantity
+                     << ", Status: " << donation.status << "\n";
+            }
+        }
+    }
+
+    void generateReport()
+    {
+        if (donations.empty())
+        {
+            std::cout << "No donations to generate report.\n";
+            return;
+        }
+
+        std::map<std::string, int> locationCount;
+        std::map<std::string, int> foodTypeCount;
+        int totalPotentialWaste = 0;
+
+        for (const auto &donation : donations)
+        {
+            locationCount[donation.location] += donation.quantity;
+            foodTypeCount[donation.foodType] += donation.quantity;
+            if (donation.status == "near expiry")
+            {
+                totalPotentialWaste += donation.quantity;
+            }
+        }
+
+        std::cout << "Food Donation Report:\n";
+        std::cout << "By Location:\n";
+        for (const auto &entry : locationCount)
+        {
+            std::cout << "Location: " << entry.first << ", Total Quantity: " << entry.second << "\n";
+        }
+
+        std::cout << "By Food Type:\n";
+        for (const auto &entry : foodTypeCount)
+        {
+            std::cout << "Food Type: " << entry.first << ", Total Quantity: " << entry.second << "\n";
+        }
+
+        std::cout << "Potential Food Waste (Near Expiry): " << totalPotentialWaste << " plates\n";
+    }
+};
+
+#endif
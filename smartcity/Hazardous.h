@@ -0,0 +1,331 @@
+// smartcity/Hazardous.h
+// Hazardous Waste Management System: disposal methods, inventory and the
+// risk-ordered disposal queue.
+#ifndef SMARTCITY_HAZARDOUS_H
+#define SMARTCITY_HAZARDOUS_H
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+
+struct WasteCategory
+{
+    std::string name;
+    std::string description;
+    int defaultRiskLevel;
+    std::vector<std::string> disposalMethods;
+};
+
+const std::vector<WasteCategory> WASTE_CATEGORIES = {
+    {"RADIOACTIVE", "Nuclear waste, radioactive materials", 10, {"Underground geological repository disposal", "Decay storage in lead-lined containers"}},
+    {"INFECTIOUS", "Medical waste, biological materials", 9, {"Autoclave sterilization followed by incineration", "Chemical disinfection and secure landfill disposal"}},
+    {"TOXIC", "Pesticides, heavy metals, poisonous materials", 8, {"Chemical treatment and neutralization", "Secure landfill with chemical stabilization"}},
+    {"REACTIVE", "Explosive materials, unstable compounds", 8, {"Controlled detonation in designated areas", "Chemical stabilization followed by secure disposal"}},
+    {"CORROSIVE", "Acids, batteries, cleaning chemicals", 7, {"Neutralization followed by wastewater treatment", "Recovery and recycling of acid/base components"}},
+    {"IGNITABLE", "Flammable liquids, solvents, oils", 6, {"Controlled incineration at licensed facilities", "Fuel blending for energy recovery"}},
+    {"CHEMICAL", "Laboratory chemicals, industrial compounds", 5, {"Chemical oxidation or reduction treatment", "Solidification and stabilization before disposal"}},
+    {"E-WASTE", "Electronic equipment, circuit boards", 4, {"Component separation and recycling", "Precious metal recovery and safe disposal"}}};
+
+inline void logAction(const std::string &action)
+{
+    std::ofstream logFile("hazardous_waste_log.txt", std::ios::app);
+    if (logFile.is_open())
+    {
+        time_t now = time(nullptr);
+        logFile << ctime(&now) << " - " << action << "\n";
+        logFile.close();
+    }
+}
+
+struct HazardousItem
+{
+    std::string name;
+    std::string category;
+    std::string disposalMethod;
+    int riskLevel;
+
+    HazardousItem(std::string n, std::string c, std::string d, int r)
+        : name(n), category(c), disposalMethod(d), riskLevel(r) {}
+};
+
+struct CompareRisk
+{
+    bool operator()(const HazardousItem &a, const HazardousItem &b)
+    {
+        return a.riskLevel < b.riskLevel;
+    }
+};
+
+class Hazardous_System
+{
+private:
+    std::unordered_map<std::string, std::string> disposalMethods;
+    std::unordered_map<std::string, int> itemInventory;
+    std::priority_queue<HazardousItem, std::vector<HazardousItem>, CompareRisk> disposalQueue;
+
+    WalStore store;          // keys: "method:<item>", "stock:<item>", "queue:<walKey(n)>"
+    long long nextQueueKey;  // only grows, so a key is never reused while an older log may still hold it
+
+    static std::string encodeItem(const HazardousItem &item)
+    {
+        return RecordWriter().putString(item.name).putString(item.category).putString(item.disposalMethod)
+            .putInt(item.riskLevel).str();
+    }
+
+    // Snapshot keys are renumbered from 0, but nextQueueKey is left alone: if
+    // the compaction fails, the old log still holds keys up to it
+    void saveStateToFile(WalStore::SnapshotWriter &out) const
+    {
+        for (const auto &pair : disposalMethods)
+        {
+            out.put("method:" + pair.first, RecordWriter().putString(pair.second).str());
+        }
+        for (const auto &pair : itemInventory)
+        {
+            out.put("stock:" + pair.first, RecordWriter().putInt(pair.second).str());
+        }
+        long long key = 0;
+        auto tempQueue = disposalQueue;
+        while (!tempQueue.empty())
+        {
+            out.put("queue:" + walKey(key++), encodeItem(tempQueue.top()));
+            tempQueue.pop();
+        }
+    }
+
+    void loadStateFromFile()
+    {
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importDisposalMethodsFromTextFile();
+            importInventoryFromTextFile();
+            importDisposalQueueFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records)
+        {
+            const std::string &key = record.first;
+            RecordReader in(record.second);
+            if (key.compare(0, 7, "method:") == 0)
+            {
+                disposalMethods[key.substr(7)] = in.getString();
+            }
+            else if (key.compare(0, 6, "stock:") == 0)
+            {
+                itemInventory[key.substr(6)] = in.getInt();
+            }
+            else if (key.compare(0, 6, "queue:") == 0)
+            {
+                std::string name = in.getString();
+                std::string category = in.getString();
+                std::string method = in.getString();
+                int riskLevel = in.getInt();
+                disposalQueue.emplace(name, category, method, riskLevel);
+                nextQueueKey = std::max(nextQueueKey, std::stoll(key.substr(6)) + 1);
+            }
+        }
+    }
+
+    // One-time migration from the old disposal_methods.txt, inventory.txt and disposal_queue.txt
+    void importDisposalMethodsFromTextFile()
+    {
+        std::ifstream inFile("disposal_methods.txt");
+        if (inFile.is_open())
+        {
+            std::string line;
+            while (std::getline(inFile, line))
+            {
+                size_t pos = line.find(',');
+                std::string item = line.substr(0, pos);
+                std::string method = line.substr(pos + 1);
+                disposalMethods[item] = method;
+            }
+            inFile.close();
+        }
+    }
+
+    void importInventoryFromTextFile()
+    {
+        std::ifstream inFile("inventory.txt");
+        if (inFile.is_open())
+        {
+            std::string line;
+            while (std::getline(inFile, line))
+            {
+                size_t pos = line.find(',');
+                std::string item = line.substr(0, pos);
+                int count = std::stoi(line.substr(pos + 1));
+                itemInventory[item] = count;
+            }
+            inFile.close();
+        }
+    }
+
+    void importDisposalQueueFromTextFile()
+    {
+        std::ifstream inFile("disposal_queue.txt");
+        if (inFile.is_open())
+        {
+            std::string line;
+            while (std::getline(inFile, line))
+            {
+                size_t pos1 = line.find(',');
+                size_t pos2 = line.find(',', pos1 + 1);
+                size_t pos3 = line.find(',', pos2 + 1);
+                std::string name = line.substr(0, pos1);
+                std::string category = line.substr(pos1 + 1, pos2 - pos1 - 1);
+                std::string method = line.substr(pos2 + 1, pos3 - pos2 - 1);
+                int riskLevel = std::stoi(line.substr(pos3 + 1));
+                disposalQueue.emplace(name, category, method, riskLevel);
+                nextQueueKey++;
+            }
+            inFile.close();
+        }
+    }
+
+public:
+    // Every change appends its record to <storeName>.wal; the constructor
+    // loads the snapshot and replays the log tail
+    explicit Hazardous_System(const std::string &storeName = "smartcity_hazardous")
+        : store(storeName, [this](WalStore::SnapshotWriter &out) { saveStateToFile(out); }), nextQueueKey(0)
+    {
+        loadStateFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    void displayWasteCategories()
+    {
+        std::cout << "\nPredefined Hazardous Waste Categories:\n";
+        std::cout << std::string(100, '=') << "\n";
+        std::cout << std::setw(15) << std::left << "Category"
+             << std::setw(45) << std::left << "| Description"
+             << std::setw(15) << std::left << "| Risk Level"
+             << "| Recommended Disposal Methods\n";
+        std::cout << std::string(100, '=') << "\n";
+
+        for (const auto &category : WASTE_CATEGORIES)
+        {
+            std::cout << std::setw(15) << std::left << category.name
+                 << "| " << std::setw(43) << std::left << category.description
+                 << "| " << std::setw(13) << std::left << category.defaultRiskLevel
+                 << "| 1. " << category.disposalMethods[0] << "\n";
+            std::cout << std::setw(15) << " "
+                 << "| " << std::setw(43) << " "
+                 << "| " << std::setw(13) << " "
+                 << "| 2. " << category.disposalMethods[1] << "\n";
+            std::cout << std::string(100, '-') << "\n";
+        }
+    }
+
+    std::vector<std::string> getRecommendedDisposalMethods(const std::string &category)
+    {
+        for (const auto &cat : WASTE_CATEGORIES)
+        {
+            if (cat.name == category)
+            {
+                return cat.disposalMethods;
+            }
+        }
+        return std::vector<std::string>();
+    }
+
+    int getDefaultRiskLevel(const std::string &category)
+    {
+        for (const auto &cat : WASTE_CATEGORIES)
+        {
+            if (cat.name == category)
+            {
+                return cat.defaultRiskLevel;
+            }
+        }
+        return 5;
+    }
+
+    void addDisposalMethod(const std::string &item, const std::string &method)
+    {
+        disposalMethods[item] = method;
+        store.put("method:" + item, RecordWriter().putString(method).str());
+        std::cout << "hazardous: Added disposal method for " << item << " -> " << method << "\n";
+        logAction("Added disposal method for " + item + " -> " + method);
+    }
+
+    void updateInventory(const std::string &item, int count)
+    {
+        itemInventory[item] += count;
+        store.put("stock:" + item, RecordWriter().putInt(itemInventory[item]).str());
+        std::cout << "hazardous: Updated inventory for " << item << " by " << count << " units. Total: " << itemInventory[item] << "\n";
+        logAction("Updated inventory for " + item + " by " + std::to_string(count) + " units");
+    }
+
+    void displayDisposalMethods()
+    {
+        std::cout << "\nDisposal Methods:\n";
+        for (const auto &pair : disposalMethods)
+        {
+            std::cout << "Item: " << pair.first << " -> Method: " << pair.second << "\n";
+        }
+    }
+
+    void displayInventory()
+    {
+        std::cout << "\nItem Inventory:\n";
+        for (const auto &pair : itemInventory)
+        {
+            std::cout << "Item: " << pair.first << " -> Quantity: " << pair.second << "\n";
+        }
+    }
+
+    void enqueueHazardousItem(const std::string &name, const std::string &category, int riskLevel)
+    {
+        auto known = disposalMethods.find(name);
+        std::string disposalMethod = known != disposalMethods.end() ? known->second : "";
+        if (disposalMethod.empty())
+        {
+            auto recommendedMethods = getRecommendedDisposalMethods(category);
+            if (!recommendedMethods.empty())
+            {
+                std::cout << "\nRecommended disposal methods for " << category << ":\n";
+                for (size_t i = 0; i < recommendedMethods.size(); ++i)
+                {
+                    std::cout << i + 1 << ". " << recommendedMethods[i] << "\n";
+                }
+            }
+        }
+        disposalQueue.emplace(name, category, disposalMethod, riskLevel);
+        store.put("queue:" + walKey(nextQueueKey++), encodeItem(HazardousItem(name, category, disposalMethod, riskLevel)));
+        std::cout << "hazardous: Enqueued hazardous item: " << name << " with risk level: " << riskLevel << "\n";
+        logAction("Enqueued hazardous item: " + name + " with risk level: " + std::to_string(riskLevel));
+    }
+
+    void viewDisposalQueue()
+    {
+        std::cout << "\nPending Disposal Queue:\n";
+        auto tempQueue = disposalQueue;
+        while (!tempQueue.empty())
+        {
+            HazardousItem item = tempQueue.top();
+            tempQueue.pop();
+            std::cout << "Item: " << item.name
+                 << " | Category: " << item.category
+                 << " | Risk Level: " << item.riskLevel << "\n";
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,307 @@
+// smartcity/Instrumentation.h
+// Hot-path metrics for the smart city modules: named counters, latency histograms
+// and scoped timers, exported as one JSON document.
+//
+// Recording is a few relaxed atomic operations, so it is safe from any thread and
+// cheap enough for per-request paths. Look a metric up once and keep the
+// reference, since the registry lookup itself takes a lock:
+//
+//     static Histogram &loadTime = metrics().histogram("storage.graph.load");
+//     ScopedTimer timer(loadTime);
+//
+// Metrics are collected only while metrics().isEnabled(); otherwise a timer
+// does not even read the clock.
+#ifndef SMARTCITY_INSTRUMENTATION_H
+#define SMARTCITY_INSTRUMENTATION_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+class Counter
+{
+private:
+    std::atomic<uint64_t> value;
+
+public:
+    Counter() : value(0) {}
+
+    void add(uint64_t amount = 1)
+    {
+        value.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    uint64_t get() const
+    {
+        return value.load(std::memory_order_relaxed);
+    }
+
+    void reset()
+    {
+        value.store(0, std::memory_order_relaxed);
+    }
+};
+
+// Log-linear histogram of non-negative values (nanoseconds for timers). Each power
+// of two is split into 8 buckets, so a reported percentile is within 12.5% of
+// the recorded value; count, sum, min and max are exact.
+class Histogram
+{
+private:
+    enum { SUB_BUCKETS = 8, SUB_BITS = 3, BUCKETS = (64 - SUB_BITS + 1) * SUB_BUCKETS };
+
+    std::atomic<uint64_t> buckets[BUCKETS];
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> sum;
+    std::atomic<uint64_t> minValue;
+    std::atomic<uint64_t> maxValue;
+
+    static int highestBit(uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63 - __builtin_clzll(value);
+#else
+        int bit = 0;
+        while (value >>= 1)
+            bit++;
+        return bit;
+#endif
+    }
+
+    static int bucketOf(uint64_t value)
+    {
+        if (value < SUB_BUCKETS)
+            return (int)value;
+        int exponent = highestBit(value);
+        int sub = (int)(value >> (exponent - SUB_BITS)) & (SUB_BUCKETS - 1);
+        return (exponent - SUB_BITS + 1) * SUB_BUCKETS + sub;
+    }
+
+    // Largest value that falls into the bucket
+    static uint64_t bucketLimit(int bucket)
+    {
+        if (bucket < SUB_BUCKETS)
+            return bucket;
+        int exponent = bucket / SUB_BUCKETS + SUB_BITS - 1;
+        uint64_t width = 1ULL << (exponent - SUB_BITS);
+        uint64_t lower = (uint64_t)(SUB_BUCKETS + bucket % SUB_BUCKETS) << (exponent - SUB_BITS);
+        return lower + (width - 1);
+    }
+
+public:
+    Histogram()
+    {
+        reset();
+    }
+
+    void record(uint64_t value)
+    {
+        buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(value, std::memory_order_relaxed);
+        uint64_t seen = minValue.load(std::memory_order_relaxed);
+        while (value < seen && !minValue.compare_exchange_weak(seen, value, std::memory_order_relaxed))
+        {
+        }
+        seen = maxValue.load(std::memory_order_relaxed);
+        while (value > seen && !maxValue.compare_exchange_weak(seen, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    uint64_t getCount() const
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    uint64_t getSum() const
+    {
+        return sum.load(std::memory_order_relaxed);
+    }
+
+    uint64_t getMin() const
+    {
+        return getCount() == 0 ? 0 : minValue.load(std::memory_order_relaxed);
+    }
+
+    uint64_t getMax() const
+    {
+        return maxValue.load(std::memory_order_relaxed);
+    }
+
+    // Upper bound of the bucket holding the p-th fraction of values, clamped to max
+    uint64_t percentile(double p) const
+    {
+        uint64_t total = getCount();
+        if (total == 0)
+            return 0;
+        uint64_t rank = (uint64_t)(p * (total - 1)) + 1;
+        uint64_t seen = 0;
+        for (int bucket = 0; bucket < BUCKETS; bucket++)
+        {
+            seen += buckets[bucket].load(std::memory_order_relaxed);
+            if (seen >= rank)
+                return std::min(bucketLimit(bucket), getMax());
+        }
+        return getMax();
+    }
+
+    void reset()
+    {
+        for (auto &bucket : buckets)
+            bucket.store(0, std::memory_order_relaxed);
+        count.store(0, std::memory_order_relaxed);
+        sum.store(0, std::memory_order_relaxed);
+        minValue.store(UINT64_MAX, std::memory_order_relaxed);
+        maxValue.store(0, std::memory_order_relaxed);
+    }
+};
+
+class MetricsRegistry
+{
+private:
+    mutable std::mutex lock;
+    std::map<std::string, std::unique_ptr<Counter>> counters;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms;
+    std::atomic<bool> enabled;
+
+    static std::string quoted(const std::string &text)
+    {
+        std::string out = "\"";
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        return out + "\"";
+    }
+
+public:
+    MetricsRegistry() : enabled(false) {}
+
+    bool isEnabled() const
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool on)
+    {
+        enabled.store(on, std::memory_order_relaxed);
+    }
+
+    // The returned reference stays valid for the life of the registry
+    Counter &counter(const std::string &name)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        std::unique_ptr<Counter> &slot = counters[name];
+        if (!slot)
+            slot.reset(new Counter());
+        return *slot;
+    }
+
+    Histogram &histogram(const std::string &name)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        std::unique_ptr<Histogram> &slot = histograms[name];
+        if (!slot)
+            slot.reset(new Histogram());
+        return *slot;
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (auto &entry : counters)
+            entry.second->reset();
+        for (auto &entry : histograms)
+            entry.second->reset();
+    }
+
+    // {"counters": {name: value}, "histograms": {name: {count, sum, min, mean,
+    // p50, p90, p99, p999, max}}}; timer histograms are in nanoseconds
+    std::string toJson() const
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        std::ostringstream out;
+        out << "{\n  \"counters\": {";
+        const char *separator = "\n";
+        for (const auto &entry : counters)
+        {
+            out << separator << "    " << quoted(entry.first) << ": " << entry.second->get();
+            separator = ",\n";
+        }
+        out << (counters.empty() ? "}" : "\n  }") << ",\n  \"histograms\": {";
+        separator = "\n";
+        for (const auto &entry : histograms)
+        {
+            const Histogram &h = *entry.second;
+            uint64_t count = h.getCount();
+            out << separator << "    " << quoted(entry.first) << ": {\"count\": " << count << ", \"sum\": " << h.getSum()
+                << ", \"min\": " << h.getMin() << ", \"mean\": " << (count ? h.getSum() / count : 0)
+                << ", \"p50\": " << h.percentile(0.5) << ", \"p90\": " << h.percentile(0.9)
+                << ", \"p99\": " << h.percentile(0.99) << ", \"p999\": " << h.percentile(0.999)
+                << ", \"max\": " << h.getMax() << "}";
+            separator = ",\n";
+        }
+        out << (histograms.empty() ? "}" : "\n  }") << "\n}\n";
+        return out.str();
+    }
+
+    bool writeJson(const std::string &fileName) const
+    {
+        std::ofstream outFile(fileName);
+        if (!outFile.is_open())
+            return false;
+        outFile << toJson();
+        return outFile.good();
+    }
+};
+
+inline MetricsRegistry &metrics()
+{
+    static MetricsRegistry registry;
+    return registry;
+}
+
+// Records the lifetime of the enclosing scope, in nanoseconds
+class ScopedTimer
+{
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    Histogram *histogram;
+    Clock::time_point start;
+
+public:
+    explicit ScopedTimer(Histogram &target) : histogram(metrics().isEnabled() ? &target : nullptr)
+    {
+        if (histogram)
+            start = Clock::now();
+    }
+
+    ~ScopedTimer()
+    {
+        if (histogram)
+            histogram->record(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+};
+
+// Counter increment that respects metrics().isEnabled()
+inline void countEvent(Counter &counter, uint64_t amount = 1)
+{
+    if (metrics().isEnabled())
+        counter.add(amount);
+}
+
+#endif
@@ -0,0 +1,162 @@
+// smartcity/Marketplace.h
+// Recycled Product Marketplace: product catalog by category.
+#ifndef SMARTCITY_MARKETPLACE_H
+#define SMARTCITY_MARKETPLACE_H
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+#include "Instrumentation.h"
+
+//  Structure to represent a product
+struct Product
+{
+    std::string name;
+    std::string category;
+    double price;
+
+    Product(std::string n, std::string c, double p) : name(n), category(c), price(p) {}
+};
+
+class Recycled_Product_Marketplace
+{
+private:
+    std::unordered_map<std::string, std::vector<Product>> productCatalog; // Maps categories to products
+    std::string legacyFile;
+    WalStore store;           // one record per product, keyed by walKey(n)
+    long long nextProductKey; // only grows, so a key is never reused while an older log may still hold it
+
+    static std::string encodeProduct(const Product &product)
+    {
+        return RecordWriter().putString(product.category).putString(product.name).putDouble(product.price).str();
+    }
+
+    void saveProductsToFile(WalStore::SnapshotWriter &out) const
+    {
+        static Histogram &saveTime = metrics().histogram("storage.products.save");
+        ScopedTimer timer(saveTime);
+
+        long long key = 0;
+        for (const auto &pair : productCatalog)
+        {
+            for (const auto &product : pair.second)
+            {
+                out.put(walKey(key++), encodeProduct(product));
+            }
+        }
+    }
+
+    void loadProductsFromFile()
+    {
+        static Histogram &loadTime = metrics().histogram("storage.products.load");
+        ScopedTimer timer(loadTime);
+
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importProductsFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records)
+        {
+            RecordReader in(record.second);
+            std::string category = in.getString();
+            std::string name = in.getString();
+            double price = in.getDouble();
+            productCatalog[category].emplace_back(name, category, price);
+            nextProductKey = std::max(nextProductKey, std::stoll(record.first) + 1);
+        }
+    }
+
+    // One-time migration from the old comma-separated products.txt
+    void importProductsFromTextFile()
+    {
+        std::ifstream inFile(legacyFile);
+        if (inFile.is_open())
+        {
+            std::string line;
+            while (std::getline(inFile, line))
+            {
+                size_t pos1 = line.find(',');
+                size_t pos2 = line.find(',', pos1 + 1);
+                std::string category = line.substr(0, pos1);
+                std::string name = line.substr(pos1 + 1, pos2 - pos1 - 1);
+                double price = std::stod(line.substr(pos2 + 1));
+                productCatalog[category].emplace_back(name, category, price);
+                nextProductKey++;
+            }
+            inFile.close();
+        }
+    }
+
+public:
+    // Every new product appends one record to <storeName>.wal; the constructor
+    // loads the snapshot and replays the log tail
+    explicit Recycled_Product_Marketplace(const std::string &storeName = "smartcity_products",
+                                          const std::string &legacyFile = "products.txt")
+        : legacyFile(legacyFile),
+          store(storeName, [this](WalStore::SnapshotWriter &out) { saveProductsToFile(out); }), nextProductKey(0)
+    {
+        loadProductsFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    // The category argument is the catalog key; the stored product and its log
+    // record take it, whatever product.category said
+    void addProduct(const std::string &category, const Product &product)
+    {
+        std::vector<Product> &categoryProducts = productCatalog[category];
+        categoryProducts.push_back(product);
+        categoryProducts.back().category = category;
+        store.put(walKey(nextProductKey++), encodeProduct(categoryProducts.back()));
+        std::cout << "Added product: " << product.name << " in category: " << category << "\n";
+    }
+
+    void displayProducts()
+    {
+        for (const auto &pair : productCatalog)
+        {
+            std::cout << "Category: " << pair.first << "\n";
+            for (const auto &product : pair.second)
+            {
+                std::cout << "  Name: " << product.name
+                     << ", Price: $" << product.price << "\n";
+            }
+        }
+    }
+
+    std::vector<Product> searchProducts(const std::string &category)
+    {
+        static Histogram &searchTime = metrics().histogram("search.products_by_category");
+        ScopedTimer timer(searchTime);
+
+        std::vector<Product> result;
+        if (productCatalog.find(category) != productCatalog.end())
+        {
+            result = productCatalog[category];
+        }
+        return result;
+    }
+
+    void sortProductsByPrice(std::vector<Product> &products)
+    {
+        // Sort by price in ascending order
+        std::sort(products.begin(), products.end(), [](const Product &a, const Product &b)
+             { return a.price < b.price; });
+    }
+};
+
+#endif
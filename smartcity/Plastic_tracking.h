@@ -0,0 +1,175 @@
+// smartcity/Plastic_tracking.h
+// Plastic Waste Tracking System: plastic waste records.
+#ifndef SMARTCITY_PLASTIC_TRACKING_H
+#define SMARTCITY_PLASTIC_TRACKING_H
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+
+//  Structure to store waste records
+struct WasteRecord
+{
+    std::string source;
+    double quantity;
+    std::string status;
+};
+
+class WasteTrackingSystem
+{
+private:
+    std::vector<WasteRecord> records;
+    WalStore store; // one record per entry, keyed by walKey(its index in records)
+
+    static std::string encodeRecord(const WasteRecord &record)
+    {
+        return RecordWriter().putString(record.source).putDouble(record.quantity).putString(record.status).str();
+    }
+
+    // Entries are never removed, so the index is a stable key
+    void saveRecordsToFile(WalStore::SnapshotWriter &out) const
+    {
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            out.put(walKey(i), encodeRecord(records[i]));
+        }
+    }
+
+    // Function to load records from the snapshot and log
+    void loadRecordsFromFile()
+    {
+        std::vector<std::pair<std::string, std::string>> stored;
+        if (!store.open(stored))
+        {
+            importRecordsFromTextFile();
+            store.compact();
+            return;
+        }
+
+        // open() returns records in first-write order, which is index order here
+        for (const auto &entry : stored)
+        {
+            RecordReader in(entry.second);
+            std::string source = in.getString();
+            double quantity = in.getDouble();
+            std::string status = in.getString();
+            records.push_back({source, quantity, status});
+        }
+    }
+
+    // One-time migration from the old comma-separated waste_records.txt
+    void importRecordsFromTextFile()
+    {
+        std::ifstream inFile("waste_records.txt");
+        if (inFile.is_open())
+        {
+            std::string line;
+            while (std::getline(inFile, line))
+            {
+                size_t pos1 = line.find(',');
+                size_t pos2 = line.find(',', pos1 + 1);
+                std::string source = line.substr(0, pos1);
+                double quantity = std::stod(line.substr(pos1 + 1, pos2 - pos1 - 1));
+                std::string status = line.substr(pos2 + 1);
+                records.push_back({source, quantity, status});
+            }
+            inFile.close();
+        }
+    }
+
+public:
+    // Non-interactive API
+    void addWasteRecord(const std::string &source, double quantity, const std::string &status)
+    {
+        records.push_back({source, quantity, status});
+        store.put(walKey(records.size() - 1), encodeRecord(records.back()));
+    }
+
+    // Function to add a waste record
+    void addWasteRecord()
+    {
+        std::string source;
+        double quantity;
+        std::string status;
+
+        std::cout << "\nEnter Source of Waste (e.g., Company, Farm, Household): ";
+        std::cin.ignore(); // Clear the input buffer
+        std::getline(std::cin, source);
+
+        std::cout << "Enter Quantity of Waste (kg): ";
+        std::cin >> quantity;
+
+        std::cout << "Enter Processing Status (e.g., Collected, Recycled, Disposed): ";
+        std::cin.ignore(); // Clear the input buffer
+        std::getline(std::cin, status);
+
+        // Add the record
+        addWasteRecord(source, quantity, status);
+
+        std::cout << "\nRecord Added Successfully!\n";
+        std::cout << "Source: " << source << "\n";
+        std::cout << "Quantity: " << quantity << " kg\n";
+        std::cout << "Status: " << status << "\n";
+    }
+
+    // Function to display all waste records
+    void displayRecords()
+    {
+        if (records.empty())
+        {
+            std::cout << "\nNo records to display.\n";
+            return;
+        }
+
+        // Map to store aggregated records (source+status -> total quantity)
+        std::map<std::pair<std::string, std::string>, double> aggregatedRecords;
+
+        // Aggregate quantities for same source and status
+        for (const auto &record : records)
+        {
+            std::pair<std::string, std::string> key = {record.source, record.status};
+            aggregatedRecords[key] += record.quantity;
+        }
+
+        // Display records grouped by source and status
+        std::cout << "\nDisplaying aggregated waste records:\n";
+        std::cout << "--------------------------------\n";
+
+        std::string currentSource = "";
+        for (const auto &record : aggregatedRecords)
+        {
+            // Print source header if it's a new source
+            if (currentSource != record.first.first)
+            {
+                currentSource = record.first.first;
+                std::cout << "\nSource: " << currentSource << "\n";
+                std::cout << "--------------------------------\n";
+            }
+
+            std::cout << "Status: " << record.first.second << "\n";
+            std::cout << "Total Quantity: " << record.second << " kg\n";
+            std::cout << "--------------------------------\n";
+        }
+    }
+
+    // Every record appends to <storeName>.wal rather than rewriting
+    // waste_records.txt, which the energy module appends to as well
+    explicit WasteTrackingSystem(const std::string &storeName = "smartcity_plastic")
+        : store(storeName, [this](WalStore::SnapshotWriter &out) { saveRecordsToFile(out); })
+    {
+        loadRecordsFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+};
+
+#endif
@@ -0,0 +1,112 @@
+// smartcity/Quiz.h
+// Waste Management Quiz.
+#ifndef SMARTCITY_QUIZ_H
+#define SMARTCITY_QUIZ_H
+
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+// Waste Management Quiz----------------------------------------------------------------------------------
+//  Structure for quiz questions
+struct Quiz
+{
+    std::string question;
+    std::string answer;
+};
+
+class QuizSystem
+{
+private:
+    // Quiz questions and answers related to Waste Management
+    Quiz quizBank[50] = {
+        {"What is the process of turning food waste into fertilizer called?", "composting"},
+        {"Which bin color is used for recyclable waste?", "blue"},
+        {"What material are beverage cans typically made of?", "aluminum"},
+        {"Which waste type includes vegetable peels and fruit skins?", "organic"},
+        {"What is the term for non-recyclable waste?", "garbage"},
+        {"What type of waste includes old newspapers and magazines?", "paper"},
+        {"What process separates waste into different categories?", "segregation"},
+        {"What is the term for reusing materials to make new products?", "recycling"},
+        {"Which bin color is used for general waste?", "green"},
+        {"What material is a glass bottle made of?", "glass"},
+        {"What is the term for reducing waste by using less packaging?", "source reduction"},
+        {"Which type of waste includes batteries and electronics?", "e-waste"},
+        {"What is the process of burning waste to generate energy called?", "incineration"},
+        {"What type of waste includes paint and chemicals?", "hazardous"},
+        {"Which bin color is used for compostable waste?", "brown"},
+        {"What is the term for the decay of organic matter by microorganisms?", "decomposition"},
+        {"Which material is commonly recycled to make new paper?", "cardboard"},
+        {"What type of waste includes plastic bottles and containers?", "plastic"},
+        {"What is the term for waste that is biodegradable?", "compostable"},
+        {"Which waste management method involves burying waste in the ground?", "landfilling"},
+        {"What is the term for waste that cannot be broken down naturally?", "non-biodegradable"},
+        {"What is the process of breaking down hazardous waste into less harmful substances?", "neutralization"},
+        {"Which type of waste includes construction debris?", "construction and demolition waste"},
+        {"What is the method of turning organic waste into liquid fertilizer called?", "vermicomposting"},
+        {"Which waste type includes broken furniture and large items?", "bulky waste"},
+        {"What is the method of processing waste to extract valuable materials?", "resource recovery"},
+        {"What is the term for waste generated by factories and manufacturing units?", "industrial waste"},
+        {"Which type of waste includes leftover food from hotels and restaurants?", "food waste"},
+        {"What is the term for recovering energy from waste materials?", "waste-to-energy"},
+        {"Which waste management method uses worms to break down organic matter?", "vermiculture"},
+        {"What type of waste includes garden clippings and leaves?", "green waste"},
+        {"Which color bin is commonly used for hazardous waste?", "red"},
+        {"What is the term for minimizing waste at the source?", "waste prevention"},
+        {"What is the term for using a product for a purpose other than its original use?", "upcycling"},
+        {"Which type of waste includes broken electronics and gadgets?", "e-waste"},
+        {"What is the process of shredding waste materials for easier handling called?", "compaction"},
+        {"What is the term for separating recyclable materials from non-recyclables?", "material recovery"},
+        {"What type of waste includes items like syringes and bandages?", "medical waste"},
+        {"Which waste management practice involves turning waste into compost?", "composting"},
+        {"What is the term for waste that is harmful to humans and the environment?", "toxic waste"},
+        {"Which waste type includes old tires and rubber materials?", "rubber waste"},
+        {"What is the method of treating wastewater to make it reusable called?", "wastewater treatment"},
+        {"What type of waste includes leftover building materials?", "construction waste"},
+        {"What is the term for materials like sand, bricks, and concrete debris?", "inert waste"},
+        {"Which waste management practice involves using heat to decompose organic matter?", "pyrolysis"},
+        {"What type of waste includes contaminated soil and chemicals?", "contaminated waste"},
+        {"What is the term for items that can be reused without processing?", "reusable waste"},
+        {"Which color bin is often used for recyclable plastics?", "yellow"},
+        {"What type of waste includes fertilizers and pesticides?", "agricultural waste"},
+        {"What is the term for waste produced by households?", "domestic waste"}};
+
+public:
+    QuizSystem()
+    {
+        // Seed the random number generator
+        srand(time(0));
+    }
+
+    // Function to start the quiz
+    void startQuiz()
+    {
+        std::cout << "\n--- Quiz Time! ---\n";
+
+        // Randomly select a question
+        int randomIndex = rand() % 50; // Select an index from 0 to 49
+        std::string userAnswer;
+
+        // Display the question
+        std::cout << "Question: " << quizBank[randomIndex].question << std::endl;
+        std::cout << "Your Answer: ";
+        std::cin.ignore(); // Clear newline from previous input
+        std::getline(std::cin, userAnswer);
+
+        // Convert user input to lowercase for case-insensitive comparison
+        std::transform(userAnswer.begin(), userAnswer.end(), userAnswer.begin(), ::tolower);
+
+        if (userAnswer == quizBank[randomIndex].answer)
+        {
+            std::cout << "Correct!\n";
+        }
+        else
+        {
+            std::cout << "Incorrect. The correct answer is: " << quizBank[randomIndex].answer << std::endl;
+        }
+    }
+};
+
+#endif
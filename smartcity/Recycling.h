@@ -0,0 +1,366 @@
+// smartcity/Recycling.h
+// Waste Disposal and Recycling System: recyclable and non-recyclable item lists.
+#ifndef SMARTCITY_RECYCLING_H
+#define SMARTCITY_RECYCLING_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+
+//  Function to convert string to lowercase
+inline void toLowercase(std::string &input)
+{
+    for (char &c : input)
+    {
+        if (c >= 'A' && c <= 'Z') // Check if the character is uppercase
+        {
+            c = c + ('a' - 'A'); // Convert to lowercase by adjusting ASCII value
+        }
+    }
+}
+
+// Node structure for linked list
+struct ItemNode
+{
+    std::string name;
+    ItemNode *next;
+    long long key; // record key in the recycling system's log
+    ItemNode(const std::string &itemName, long long key = -1) : name(itemName), next(nullptr), key(key) {}
+};
+
+// Recycling System
+class Recycling_System
+{
+private:
+    ItemNode *recyclableHead;
+    ItemNode *nonRecyclableHead;
+    WalStore store;        // keys: "recyclable:<walKey(n)>", "non_recyclable:<walKey(n)>"
+    long long nextItemKey; // only grows, so a deleted item's key is never reused
+
+    static std::string recordKey(const std::string &list, const ItemNode *item)
+    {
+        return list + ":" + walKey(item->key);
+    }
+
+    // Oldest item first, so prepending on load rebuilds the same list
+    void saveItemsToFile(WalStore::SnapshotWriter &out, const std::string &list, ItemNode *head) const
+    {
+        std::vector<const ItemNode *> items;
+        for (ItemNode *current = head; current; current = current->next)
+        {
+            items.push_back(current);
+        }
+        for (auto it = items.rbegin(); it != items.rend(); ++it)
+        {
+            out.put(recordKey(list, *it), (*it)->name);
+        }
+    }
+
+    void prependItem(ItemNode *&head, const std::string &itemName, long long key)
+    {
+        ItemNode *newItem = new ItemNode(itemName, key);
+        newItem->next = head;
+        head = newItem;
+        nextItemKey = std::max(nextItemKey, key + 1);
+    }
+
+    void loadItemsFromFile()
+    {
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importItemsFromTextFile("recyclable_items.txt", recyclableHead);
+            importItemsFromTextFile("non_recyclable_items.txt", nonRecyclableHead);
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records)
+        {
+            size_t colon = record.first.find(':');
+            long long key = std::stoll(record.first.substr(colon + 1));
+            if (record.first.compare(0, colon, "recyclable") == 0)
+                prependItem(recyclableHead, record.second, key);
+            else
+                prependItem(nonRecyclableHead, record.second, key);
+        }
+    }
+
+    // One-time migration from the old one-name-per-line item files
+    void importItemsFromTextFile(const std::string &filename, ItemNode *&head)
+    {
+        std::ifstream inFile(filename);
+        if (inFile.is_open())
+        {
+            std::string itemName;
+            while (std::getline(inFile, itemName))
+            {
+                prependItem(head, itemName, nextItemKey);
+            }
+            inFile.close();
+        }
+    }
+
+public:
+    // Every change appends its record to <storeName>.wal; the constructor
+    // loads the snapshot and replays the log tail
+    explicit Recycling_System(const std::string &storeName = "smartcity_recycling")
+        : recyclableHead(nullptr), nonRecyclableHead(nullptr),
+          store(storeName, [this](WalStore::SnapshotWriter &out)
+                {
+                    saveItemsToFile(out, "recyclable", recyclableHead);
+                    saveItemsToFile(out, "non_recyclable", nonRecyclableHead);
+                }),
+          nextItemKey(0)
+    {
+        loadItemsFromFile();
+    }
+
+    ~Recycling_System()
+    {
+        ItemNode *current = recyclableHead;
+        while (current)
+        {
+            ItemNode *toDelete = current;
+            current = current->next;
+            delete toDelete;
+        }
+        current = nonRecyclableHead;
+        while (current)
+        {
+            ItemNode *toDelete = current;
+            current = current->next;
+            delete toDelete;
+        }
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    // Add a recyclable item to the linked list
+    void addRecyclableItem(const std::string &itemName)
+    {
+        std::string lowerItemName = itemName;
+        toLowercase(lowerItemName); // Convert item name to lowercase before storing
+
+        // Check if the item already exists in non-recyclable items
+        if (isNonRecyclable(lowerItemName) != "")
+        {
+            std::cout << itemName << " is already in non-recyclable items. Cannot add to recyclable items.\n";
+            return;
+        }
+
+        // Add the item to recyclable items
+        prependItem(recyclableHead, lowerItemName, nextItemKey);
+        store.put(recordKey("recyclable", recyclableHead), lowerItemName);
+        std::cout << itemName << " added to recyclable items.\n";
+    }
+
+    // Add a non-recyclable item to the linked list
+    void addNonRecyclableItem(const std::string &itemName)
+    {
+        std::string lowerItemName = itemName;
+        toLowercase(lowerItemName); // Convert item name to lowercase before storing
+
+        // Check if the item already exists in recyclable items
+        if (isRecyclable(lowerItemName) != "")
+        {
+            std::cout << itemName << " is already in recyclable items. Cannot add to non-recyclable items.\n";
+            return;
+        }
+
+        // Add the item to non-recyclable items
+        prependItem(nonRecyclableHead, lowerItemName, nextItemKey);
+        store.put(recordKey("non_recyclable", nonRecyclableHead), lowerItemName);
+        std::cout << itemName << " added to non-recyclable items.\n";
+    }
+
+    // Delete a recyclable item from the linked list
+    bool deleteRecyclableItem(const std::string &itemName)
+    {
+        std::string lowerItemName = itemName;
+        toLowercase(lowerItemName); // Convert item name to lowercase before searching
+
+        ItemNode *current = recyclableHead;
+        ItemNode *previous = nullptr;
+
+        while (current)
+        {
+            if (current->name == lowerItemName)
+            {
+                if (previous)
+                    previous->next = current->next;
+                else
+                    recyclableHead = current->next;
+
+                std::string removedKey = recordKey("recyclable", current);
+                delete current;
+                store.erase(removedKey);
+                std::cout << itemName << " deleted from recyclable items.\n";
+                return true;
+            }
+            previous = current;
+            current = current->next;
+        }
+        std::cout << itemName << " not found in recyclable items.\n";
+        return false;
+    }
+
+    // Delete a non-recyclable item from the linked list
+    bool deleteNonRecyclableItem(const std::string &itemName)
+    {
+        std::string lowerItemName = itemName;
+        toLowercase(lowerItemName); // Convert item name to lowercase before searching
+
+        ItemNode *current = nonRecyclableHead;
+        ItemNode *previous = nullptr;
+
+        while (current)
+        {
+            if (current->name == lowerItemName)
+            {
+                if (previous)
+                    previous->next = current->next;
+                else
+                    nonRecyclableHead = current->next;
+
+                std::string removedKey = recordKey("non_recyclable", current);
+                delete current;
+                store.erase(removedKey);
+                std::cout << itemName << " deleted from non-recyclable items.\n";
+                return true;
+            }
+            previous = current;
+            current = current->next;
+        }
+        std::cout << itemName << " not found in non-recyclable items.\n";
+        return false;
+    }
+
+    // Modify a recyclable item in the linked list
+    bool modifyRecyclableItem(const std::string &oldName, const std::string &newName)
+    {
+        std::string lowerOldName = oldName;
+        toLowercase(lowerOldName); // Convert old name to lowercase before searching
+        std::string lowerNewName = newName;
+        toLowercase(lowerNewName); // Convert new name to lowercase before storing
+
+        ItemNode *current = recyclableHead;
+
+        while (current)
+        {
+            if (current->name == lowerOldName)
+            {
+                current->name = lowerNewName;
+                store.put(recordKey("recyclable", current), lowerNewName);
+                std::cout << oldName << " modified to " << newName << " in recyclable items.\n";
+                return true;
+            }
+            current = current->next;
+        }
+        std::cout << oldName << " not found in recyclable items.\n";
+        return false;
+    }
+
+    // Modify a non-recyclable item in the linked list
+    bool modifyNonRecyclableItem(const std::string &oldName, const std::string &newName)
+    {
+        std::string lowerOldName = oldName;
+        toLowercase(lowerOldName); // Convert old name to lowercase before searching
+        std::string lowerNewName = newName;
+        toLowercase(lowerNewName); // Convert new name to lowercase before storing
+
+        ItemNode *current = nonRecyclableHead;
+
+        while (current)
+        {
+            if (current->name == lowerOldName)
+            {
+                current->name = lowerNewName;
+                store.put(recordKey("non_recyclable", current), lowerNewName);
+                std::cout << oldName << " modified to " << newName << " in non-recyclable items.\n";
+                return true;
+            }
+            current = current->next;
+        }
+        std::cout << oldName << " not found in non-recyclable items.\n";
+        return false;
+    }
+
+    // Display all recyclable items
+    void displayRecyclableItems()
+    {
+        std::cout << "Recyclable Items:\n";
+        if (!recyclableHead)
+        {
+            std::cout << "No recyclable items available.\n";
+            return;
+        }
+        ItemNode *current = recyclableHead;
+        while (current)
+        {
+            std::cout << "- " << current->name << "\n"; // Automatically in lowercase
+            current = current->next;
+        }
+    }
+
+    // Display all non-recyclable items
+    void displayNonRecyclableItems()
+    {
+        std::cout << "Non-Recyclable Items:\n";
+        if (!nonRecyclableHead)
+        {
+            std::cout << "No non-recyclable items available.\n";
+            return;
+        }
+        ItemNode *current = nonRecyclableHead;
+        while (current)
+        {
+            std::cout << "- " << current->name << "\n"; // Automatically in lowercase
+            current = current->next;
+        }
+    }
+
+    // Brute force search: Check if an item is recyclable
+    std::string isRecyclable(const std::string &itemName)
+    {
+        std::string lowerItemName = itemName;
+        toLowercase(lowerItemName); // Convert item name to lowercase before searching
+
+        ItemNode *current = recyclableHead;
+        while (current)
+        {
+            if (current->name == lowerItemName) // Match found
+                return current->name;
+            current = current->next;
+        }
+        return ""; // No match
+    }
+
+    // Brute force search: Check if an item is non-recyclable
+    std::string isNonRecyclable(const std::string &itemName)
+    {
+        std::string lowerItemName = itemName;
+        toLowercase(lowerItemName); // Convert item name to lowercase before searching
+
+        ItemNode *current = nonRecyclableHead;
+        while (current)
+        {
+            if (current->name == lowerItemName) // Match found
+                return current->name;
+            current = current->next;
+        }
+        return ""; // No match
+    }
+};
+
+#endif
@@ -0,0 +1,566 @@
+// smartcity/Routing.h
+// Optimized Waste Collection Network: city graph, cached shortest paths,
+// distance matrices and capacity-constrained multi-truck collection plans.
+#ifndef SMARTCITY_ROUTING_H
+#define SMARTCITY_ROUTING_H
+
+#include <algorithm>
+#include <cfloat>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../Routing_engine.h"
+#include "../Write_ahead_log.h"
+#include "Instrumentation.h"
+
+// Node structure for the graph
+struct Node
+{
+    int id;
+    std::string name;
+    Node(int id, std::string name) : id(id), name(name) {}
+};
+
+// Routes are stored in fractional kilometres
+typedef WeightedEdge<float> Edge;
+typedef BasicShortestPathTree<float> ShortestPathTree;
+typedef BasicRoutingEngine<float> RoutingEngine;
+typedef BasicDistanceMatrix<float> DistanceMatrix;
+typedef BasicVehicleRoute<float> VehicleRoute;
+typedef BasicCollectionPlan<float> CollectionPlan;
+
+// Graph class with improved error handling
+class Graph
+{
+private:
+    std::vector<std::string> nodeNames;
+    std::vector<std::vector<Edge>> adjList;
+    int nodeCount;
+    mutable RoutingEngine router;
+
+    // Snapshot holds "graph" (node count, next op) and one "node:<i>" record per point;
+    // the log holds every mutation since as "op:<sequence>"
+    enum GraphOp
+    {
+        SET_NODE_COUNT = 1,
+        ADD_NODE,
+        ADD_EDGE,
+        DELETE_NODE,
+        MODIFY_NODE,
+        DELETE_EDGE,
+        MODIFY_EDGE
+    };
+    std::string legacyFile;
+    WalStore store;
+    long long nextOp;
+
+    void logOp(const RecordWriter &op)
+    {
+        store.put("op:" + walKey(nextOp++), op.str());
+    }
+
+    // The edits themselves, shared by the public API and log replay
+    void resizeNodes(int count)
+    {
+        nodeCount = count;
+        nodeNames.resize(count);
+        adjList.resize(count);
+        router.clear();
+    }
+
+    void appendNode(const std::string &name)
+    {
+        nodeNames.push_back(name);
+        adjList.emplace_back();
+        nodeCount++;
+        router.nodeAdded();
+    }
+
+    void insertEdge(int from, int to, float weight)
+    {
+        // Add edge in both directions (undirected graph)
+        adjList[from].push_back(Edge(from, to, weight));
+        adjList[to].push_back(Edge(to, from, weight));
+        router.edgeAdded(from, to, weight);
+    }
+
+    void removeNode(int nodeIndex)
+    {
+        // Remove the node and adjust all other nodes
+        nodeNames.erase(nodeNames.begin() + nodeIndex);
+        adjList.erase(adjList.begin() + nodeIndex);
+
+        // Update remaining edges
+        for (auto &edges : adjList)
+        {
+            edges.erase(
+                std::remove_if(edges.begin(), edges.end(),
+                          [nodeIndex](const Edge &e)
+                          {
+                              return e.to == nodeIndex || e.from == nodeIndex;
+                          }),
+                edges.end());
+
+            // Update indices for remaining edges
+            for (Edge &e : edges)
+            {
+                if (e.to > nodeIndex)
+                {
+                    e.to--;
+                }
+
+                if (e.from > nodeIndex)
+                {
+                    e.from--;
+                }
+            }
+        }
+
+        nodeCount--;
+        router.nodeDeleted(nodeIndex);
+    }
+
+    void removeEdge(int from, int to)
+    {
+        // Remove edge in both directions
+        auto removeDirected = [](std::vector<Edge> &edges, int from, int to)
+        {
+            edges.erase(
+                std::remove_if(edges.begin(), edges.end(),
+                          [from, to](const Edge &e)
+                          {
+                              return e.from == from && e.to == to;
+                          }),
+                edges.end());
+        };
+
+        removeDirected(adjList[from], from, to);
+        removeDirected(adjList[to], to, from);
+        router.edgeDeleted(from, to);
+    }
+
+    bool changeEdgeWeight(int from, int to, float newWeight)
+    {
+        // Modify edge in both directions
+        float oldWeight = -1;
+        auto modifyEdgeWeight = [newWeight, &oldWeight](std::vector<Edge> &edges, int from, int to)
+        {
+            for (Edge &e : edges)
+            {
+                if (e.from == from && e.to == to)
+                {
+                    oldWeight = e.weight;
+                    e.weight = newWeight;
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        bool result = modifyEdgeWeight(adjList[from], from, to) &&
+                      modifyEdgeWeight(adjList[to], to, from);
+        if (result)
+        {
+            router.edgeWeightChanged(from, to, oldWeight, newWeight);
+        }
+        return result;
+    }
+
+    bool validNode(int index) const
+    {
+        return index >= 0 && index < nodeCount;
+    }
+
+    void replayOp(RecordReader &in)
+    {
+        switch (in.getInt())
+        {
+        case SET_NODE_COUNT:
+            resizeNodes(in.getInt());
+            break;
+        case ADD_NODE:
+            appendNode(in.getString());
+            break;
+        case ADD_EDGE:
+        {
+            int from = in.getInt(), to = in.getInt();
+            float weight = in.getDouble();
+            if (validNode(from) && validNode(to))
+                insertEdge(from, to, weight);
+            break;
+        }
+        case DELETE_NODE:
+        {
+            int index = in.getInt();
+            if (validNode(index))
+                removeNode(index);
+            break;
+        }
+        case MODIFY_NODE:
+        {
+            int index = in.getInt();
+            std::string name = in.getString();
+            if (validNode(index))
+                nodeNames[index] = name;
+            break;
+        }
+        case DELETE_EDGE:
+        {
+            int from = in.getInt(), to = in.getInt();
+            if (validNode(from) && validNode(to))
+                removeEdge(from, to);
+            break;
+        }
+        case MODIFY_EDGE:
+        {
+            int from = in.getInt(), to = in.getInt();
+            float weight = in.getDouble();
+            if (validNode(from) && validNode(to))
+                changeEdgeWeight(from, to, weight);
+            break;
+        }
+        }
+    }
+
+    void saveGraphToFile(WalStore::SnapshotWriter &out) const
+    {
+        static Histogram &saveTime = metrics().histogram("storage.graph.save");
+        ScopedTimer timer(saveTime);
+
+        out.put("graph", RecordWriter().putInt(nodeCount).putInt(nextOp).str());
+        for (int i = 0; i < nodeCount; ++i)
+        {
+            RecordWriter node;
+            node.putString(nodeNames[i]).putInt(adjList[i].size());
+            for (const Edge &edge : adjList[i])
+            {
+                node.putInt(edge.to).putDouble(edge.weight);
+            }
+            out.put("node:" + walKey(i), node.str());
+        }
+    }
+
+    void loadGraphFromFile()
+    {
+        static Histogram &loadTime = metrics().histogram("storage.graph.load");
+        ScopedTimer timer(loadTime);
+
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importGraphFromTextFile();
+            store.compact();
+            return;
+        }
+
+        long long snapshotOps = 0;
+        for (const auto &record : records)
+        {
+            const std::string &key = record.first;
+            RecordReader in(record.second);
+            if (key == "graph")
+            {
+                nodeCount = in.getInt();
+                snapshotOps = nextOp = in.getInt();
+                nodeNames.assign(nodeCount, "");
+                adjList.assign(nodeCount, std::vector<Edge>());
+            }
+            else if (key.compare(0, 5, "node:") == 0)
+            {
+                int index = std::stoi(key.substr(5));
+                if (!validNode(index))
+                    continue;
+                nodeNames[index] = in.getString();
+                int edgeCount = in.getInt();
+                for (int e = 0; e < edgeCount; ++e)
+                {
+                    int to = in.getInt();
+                    adjList[index].push_back(Edge(index, to, (float)in.getDouble()));
+                }
+            }
+            else if (key.compare(0, 3, "op:") == 0)
+            {
+                long long sequence = std::stoll(key.substr(3));
+                if (sequence < snapshotOps)
+                    continue; // already folded into the snapshot
+                replayOp(in);
+                nextOp = sequence + 1;
+            }
+        }
+        router.clear();
+    }
+
+    // One-time migration from the old graph.txt: node count, one name per line, then "from to weight" edges
+    void importGraphFromTextFile()
+    {
+        std::ifstream inFile(legacyFile);
+        if (inFile.is_open())
+        {
+            inFile >> nodeCount;
+            inFile.ignore();
+            nodeNames.resize(nodeCount);
+            adjList.resize(nodeCount);
+            for (auto &name : nodeNames)
+            {
+                std::getline(inFile, name);
+            }
+            int from, to;
+            float weight;
+            while (inFile >> from >> to >> weight)
+            {
+                adjList[from].push_back(Edge(from, to, weight));
+            }
+            inFile.close();
+            router.clear();
+        }
+    }
+
+public:
+    // Every edit appends one op to <storeName>.wal; the constructor loads the
+    // snapshot and replays the ops logged since
+    explicit Graph(const std::string &storeName = "smartcity_graph", const std::string &legacyFile = "graph.txt")
+        : nodeCount(0), legacyFile(legacyFile),
+          store(storeName, [this](WalStore::SnapshotWriter &out) { saveGraphToFile(out); }), nextOp(0)
+    {
+        loadGraphFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    void setNodeCount(int count)
+    {
+        resizeNodes(count);
+        logOp(RecordWriter().putInt(SET_NODE_COUNT).putInt(count));
+    }
+
+    bool addNode(const std::string &name)
+    {
+        appendNode(name);
+        logOp(RecordWriter().putInt(ADD_NODE).putString(name));
+        std::cout << "Collection Point added successfully.\n";
+        return true;
+    }
+
+    bool addEdge(const std::string &fromName, const std::string &toName, float weight)
+    {
+        int from = getNodeIndex(fromName);
+        int to = getNodeIndex(toName);
+
+        if (from == -1 || to == -1 || weight < 0)
+        {
+            std::cout << "Failed to add Route.\n";
+            return false;
+        }
+
+        insertEdge(from, to, weight);
+        logOp(RecordWriter().putInt(ADD_EDGE).putInt(from).putInt(to).putDouble(weight));
+        std::cout << "Route added successfully.\n";
+        return true;
+    }
+
+    bool deleteNode(const std::string &name)
+    {
+        int nodeIndex = getNodeIndex(name);
+        if (!validNode(nodeIndex))
+        {
+            std::cout << "Failed to delete Collection Point.\n";
+            return false;
+        }
+
+        removeNode(nodeIndex);
+        logOp(RecordWriter().putInt(DELETE_NODE).putInt(nodeIndex));
+        std::cout << "Collection point '" << name << "' has been deleted successfully.\n";
+        return true;
+    }
+
+    bool modifyNode(const std::string &oldName, const std::string &newName)
+    {
+        int nodeIndex = getNodeIndex(oldName);
+        if (!validNode(nodeIndex))
+        {
+            std::cout << "Failed to modify Collection Point.\n";
+            return false;
+        }
+        nodeNames[nodeIndex] = newName;
+        logOp(RecordWriter().putInt(MODIFY_NODE).putInt(nodeIndex).putString(newName));
+        std::cout << "Collection point '" << oldName << "' has been renamed to '" << newName << "' successfully.\n";
+        return true;
+    }
+
+    bool deleteEdge(const std::string &fromName, const std::string &toName)
+    {
+        int from = getNodeIndex(fromName);
+        int to = getNodeIndex(toName);
+
+        if (from == -1 || to == -1)
+        {
+            std::cout << "Failed to delete Route.\n";
+            return false;
+        }
+
+        removeEdge(from, to);
+        logOp(RecordWriter().putInt(DELETE_EDGE).putInt(from).putInt(to));
+        std::cout << "Route deleted successfully.\n";
+        return true;
+    }
+
+    bool modifyEdge(const std::string &fromName, const std::string &toName, float newWeight)
+    {
+        if (newWeight < 0)
+        {
+            std::cout << "Failed to modify Route.\n";
+            return false;
+        }
+
+        int from = getNodeIndex(fromName);
+        int to = getNodeIndex(toName);
+
+        if (from == -1 || to == -1)
+        {
+            std::cout << "Failed to modify Route.\n";
+            return false;
+        }
+
+        bool result = changeEdgeWeight(from, to, newWeight);
+        if (result)
+        {
+            logOp(RecordWriter().putInt(MODIFY_EDGE).putInt(from).putInt(to).putDouble(newWeight));
+            std::cout << "Route modified successfully.\n";
+        }
+        else
+        {
+            std::cout << "Failed to modify Route.\n";
+        }
+        return result;
+    }
+
+    const std::vector<Edge> &getEdges(int node) const
+    {
+        return adjList[node];
+    }
+
+    int getNodeCount() const
+    {
+        return nodeCount;
+    }
+
+    // Cached shortest-path tree from a collection point; repeat queries are free
+    std::shared_ptr<const ShortestPathTree> shortestPaths(int source) const
+    {
+        static Counter &hits = metrics().counter("routing.tree_cache.hits");
+        static Counter &misses = metrics().counter("routing.tree_cache.misses");
+        static Histogram &treeTime = metrics().histogram("routing.shortest_path_tree");
+
+        if (router.isCached(source))
+        {
+            countEvent(hits);
+            return router.shortestPaths(adjList, source);
+        }
+        countEvent(misses);
+        ScopedTimer timer(treeTime);
+        return router.shortestPaths(adjList, source);
+    }
+
+    // Pairwise distances between collection points, computed in parallel
+    DistanceMatrix distanceMatrix(const std::vector<int> &stops) const
+    {
+        static Histogram &matrixTime = metrics().histogram("routing.distance_matrix");
+        ScopedTimer timer(matrixTime);
+        router.prepare(adjList);
+        return computeDistanceMatrix(router, stops);
+    }
+
+    const std::string &getNodeName(int index) const
+    {
+        return nodeNames[index];
+    }
+
+    int getNodeIndex(const std::string &name) const
+    {
+        for (int i = 0; i < nodeCount; ++i)
+        {
+            if (nodeNames[i] == name)
+                return i;
+        }
+        return -1;
+    }
+
+    void displayGraph()
+    {
+        std::cout << "\nCollection Points and Routes:\n";
+        for (int i = 0; i < nodeCount; ++i)
+        {
+            std::cout << "Collection Point " << nodeNames[i] << " (ID: " << i << ")\n";
+            for (const Edge &e : adjList[i])
+            {
+                std::cout << "  Route to " << nodeNames[e.to] << " with distance " << e.weight << "\n";
+            }
+        }
+    }
+};
+
+// Dijkstra's Algorithm implementation with Path Tracking
+inline void dijkstra(const Graph &cityGraph, const std::string &startName)
+{
+    int nodeCount = cityGraph.getNodeCount();
+    if (nodeCount == 0)
+    {
+        std::cout << "No collection points exist in the system.\n";
+        return;
+    }
+
+    int startNode = cityGraph.getNodeIndex(startName);
+    if (startNode == -1)
+    {
+        std::cout << "Starting collection point not found.\n";
+        return;
+    }
+
+    std::shared_ptr<const ShortestPathTree> tree = cityGraph.shortestPaths(startNode);
+    const std::vector<float> &distances = tree->distances;
+
+    // Display results
+    std::cout << "\nShortest paths from collection point " << startName << ":\n";
+    float shortestDist = FLT_MAX;
+    int targetNode = -1;
+    for (int i = 0; i < nodeCount; i++)
+    {
+        if (i != startNode)
+        {
+            const std::string &nodeName = cityGraph.getNodeName(i);
+            if (distances[i] == FLT_MAX)
+            {
+                std::cout << "Collection point " << nodeName << " is unreachable.\n";
+            }
+            else
+            {
+                std::cout << "Collection point " << nodeName << " - Distance: " << distances[i] << "\n";
+                if (distances[i] < shortestDist)
+                {
+                    shortestDist = distances[i];
+                    targetNode = i;
+                }
+            }
+        }
+    }
+
+    // Display the shortest path
+    if (targetNode != -1)
+    {
+        std::cout << "\nShortest path to collection point " << cityGraph.getNodeName(targetNode) << " (Distance: " << shortestDist << "):\n";
+        for (int node : tree->pathTo(targetNode))
+        {
+            std::cout << cityGraph.getNodeName(node) << " ";
+        }
+        std::cout << std::endl;
+    }
+}
+
+#endif
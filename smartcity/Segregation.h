@@ -0,0 +1,308 @@
+// smartcity/Segregation.h
+// Smart Waste Segregation System: waste items grouped by category.
+#ifndef SMARTCITY_SEGREGATION_H
+#define SMARTCITY_SEGREGATION_H
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+
+// Function to convert a string to lowercase
+inline std::string toLowerCase2(const std::string &str)
+{
+    std::string lowerStr = str;
+    std::transform(lowerStr.begin(), lowerStr.end(), lowerStr.begin(), ::tolower);
+    return lowerStr;
+}
+
+// Smart Waste Segregation System class
+class Smart_Waste_System
+{
+private:
+    struct WasteMap
+    {
+        std::string category;
+        std::vector<std::string> items;
+        long long key; // record key in the log
+    };
+
+    std::vector<WasteMap> wasteMap;
+    WalStore store;            // one record per category, keyed by walKey(WasteMap::key)
+    long long nextCategoryKey; // only grows, so a deleted category's key is never reused
+
+    std::vector<std::string> recyclableItems = {"Paper", "Glass", "Metal", "Plastic", "Cardboard", "Used books", "Tires"};
+    std::vector<std::string> nonRecyclableItems = {"Food Waste", "Styrofoam", "Ceramics", "Diapers", "Hazardous Waste", "Cigarette butts", "Broken mirrors"};
+    std::vector<std::string> organicItems = {"Food scraps", "Coffee grounds and tea bags", "Eggshells", "Yard clippings and grass", "Fallen leaves", "Animal manure", "Stale bread"};
+    std::vector<std::string> hazardousItems = {"Batteries", "Paints and solvents", "Pesticides", "Motor oil and lubricants", "Cleaning agents", "Mercury thermometers", "Herbicides"};
+    std::vector<std::string> medicalItems = {"Used syringes and needles", "Bandages and dressings", "Expired medications", "Used gloves", "IV bags and tubing", "Pathological waste (tissue, blood)", "Test tubes"};
+
+    void quickSort(std::vector<std::string> &arr, int low, int high)
+    {
+        if (low < high)
+        {
+            int pi = partition(arr, low, high);
+            quickSort(arr, low, pi - 1);
+            quickSort(arr, pi + 1, high);
+        }
+    }
+
+    int partition(std::vector<std::string> &arr, int low, int high)
+    {
+        std::string pivot = arr[high];
+        int i = low - 1;
+
+        for (int j = low; j < high; ++j)
+        {
+            if (arr[j] < pivot)
+            {
+                ++i;
+                std::swap(arr[i], arr[j]);
+            }
+        }
+        std::swap(arr[i + 1], arr[high]);
+        return i + 1;
+    }
+
+    static std::string encodeCategory(const WasteMap &map)
+    {
+        RecordWriter out;
+        out.putString(map.category).putInt(map.items.size());
+        for (const auto &item : map.items)
+        {
+            out.putString(item);
+        }
+        return out.str();
+    }
+
+    // A change to an item rewrites only its own category's record
+    void saveCategory(const WasteMap &map)
+    {
+        store.put(walKey(map.key), encodeCategory(map));
+    }
+
+    void saveWasteDataToFile(WalStore::SnapshotWriter &out) const
+    {
+        for (const auto &map : wasteMap)
+        {
+            out.put(walKey(map.key), encodeCategory(map));
+        }
+    }
+
+    void loadWasteDataFromFile()
+    {
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importWasteDataFromTextFile();
+            store.compact();
+            return;
+        }
+
+        for (const auto &record : records)
+        {
+            RecordReader in(record.second);
+            WasteMap map;
+            map.category = in.getString();
+            for (long long count = in.getInt(); count > 0; count--)
+            {
+                map.items.push_back(in.getString());
+            }
+            map.key = std::stoll(record.first);
+            nextCategoryKey = std::max(nextCategoryKey, map.key + 1);
+            wasteMap.push_back(map);
+        }
+    }
+
+    // One-time migration from the old waste_data.txt. The volume predictor used
+    // the same file name for its readings, so a file without the category
+    // count header is not ours and is left alone.
+    void importWasteDataFromTextFile()
+    {
+        std::ifstream inFile("waste_data.txt");
+        if (inFile.is_open())
+        {
+            std::string header;
+            std::getline(inFile, header);
+            if (header.empty() || header.find_first_not_of("0123456789") != std::string::npos)
+            {
+                return;
+            }
+            int categoryCount = std::stoi(header);
+            wasteMap.resize(categoryCount);
+            for (int i = 0; i < categoryCount; ++i)
+            {
+                std::getline(inFile, wasteMap[i].category, ',');
+                int itemCount;
+                inFile >> itemCount;
+                inFile.ignore();
+                wasteMap[i].items.resize(itemCount);
+                for (int j = 0; j < itemCount; ++j)
+                {
+                    std::getline(inFile, wasteMap[i].items[j]);
+                }
+                wasteMap[i].key = nextCategoryKey++;
+            }
+            inFile.close();
+        }
+    }
+
+public:
+    // Every change appends its category's record to <storeName>.wal; the
+    // constructor loads the snapshot and replays the log tail
+    explicit Smart_Waste_System(const std::string &storeName = "smartcity_segregation")
+        : store(storeName, [this](WalStore::SnapshotWriter &out) { saveWasteDataToFile(out); }), nextCategoryKey(0)
+    {
+        loadWasteDataFromFile();
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    void addWaste(const std::string &category, const std::string &item)
+    {
+        int index = findCategoryIndex(category);
+        std::string lowerItem = toLowerCase2(item);
+        if (index == -1)
+        {
+            wasteMap.push_back({category, {lowerItem}, nextCategoryKey++});
+            saveCategory(wasteMap.back());
+        }
+        else
+        {
+            wasteMap[index].items.push_back(lowerItem);
+            saveCategory(wasteMap[index]);
+        }
+    }
+
+    void modifyWaste(const std::string &category, const std::string &oldItem, const std::string &newItem)
+    {
+        int index = findCategoryIndex(category);
+        if (index == -1)
+        {
+            std::cout << "Category not found.\n";
+            return;
+        }
+
+        auto &items = wasteMap[index].items;
+        auto it = std::find(items.begin(), items.end(), toLowerCase2(oldItem));
+        if (it != items.end())
+        {
+            *it = toLowerCase2(newItem);
+            saveCategory(wasteMap[index]);
+            std::cout << "Waste item \"" << oldItem << "\" modified to \"" << newItem << "\" successfully.\n";
+        }
+        else
+        {
+            std::cout << "Item not found in the category.\n";
+        }
+    }
+
+    void deleteWaste(const std::string &category, const std::string &item)
+    {
+        int index = findCategoryIndex(category);
+        if (index == -1)
+        {
+            std::cout << "Category not found.\n";
+            return;
+        }
+
+        auto &items = wasteMap[index].items;
+        auto it = std::find(items.begin(), items.end(), toLowerCase2(item));
+        if (it != items.end())
+        {
+            items.erase(it);
+            saveCategory(wasteMap[index]);
+            std::cout << "Waste item \"" << item << "\" deleted successfully.\n";
+        }
+        else
+        {
+            std::cout << "Item not found in the category.\n";
+        }
+    }
+
+    void deleteWasteCategory(const std::string &category)
+    {
+        int index = findCategoryIndex(category);
+        if (index == -1)
+        {
+            std::cout << "Category not found.\n";
+            return;
+        }
+
+        long long removedKey = wasteMap[index].key;
+        wasteMap.erase(wasteMap.begin() + index);
+        store.erase(walKey(removedKey));
+        std::cout << "Category \"" << category << "\" deleted successfully.\n";
+    }
+
+    void modifyWasteCategory(const std::string &oldCategory, const std::string &newCategory)
+    {
+        int index = findCategoryIndex(oldCategory);
+        if (index == -1)
+        {
+            std::cout << "Category not found.\n";
+            return;
+        }
+
+        wasteMap[index].category = newCategory;
+        saveCategory(wasteMap[index]);
+        std::cout << "Category \"" << oldCategory << "\" modified to \"" << newCategory << "\" successfully.\n";
+    }
+
+    void displayWasteCategories()
+    {
+        std::cout << "\nWaste Categories and Items:\n";
+        for (const auto &map : wasteMap)
+        {
+            std::cout << map.category << ": ";
+            auto items = map.items;
+            quickSort(items, 0, items.size() - 1);
+            for (size_t j = 0; j < items.size(); ++j)
+            {
+                if (j > 0)
+                    std::cout << ", ";
+                std::cout << items[j];
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    void displayPredefinedCategories()
+    {
+        std::cout << "\nPredefined Waste Categories:\n";
+        std::cout << std::left << std::setw(20) << "Recyclable" << "|" << std::setw(30) << "Non-Recyclable" << "|" << std::setw(30) << "Organic" << "|" << std::setw(30) << "Hazardous" << "|" << std::setw(30) << "Medical" << std::endl;
+        std::cout << std::string(140, '=') << std::endl;
+        for (size_t i = 0; i < recyclableItems.size(); ++i)
+        {
+            std::cout << std::left << std::setw(20) << recyclableItems[i] << "|"
+                 << std::setw(30) << nonRecyclableItems[i] << "|"
+                 << std::setw(30) << organicItems[i] << "|"
+                 << std::setw(30) << hazardousItems[i] << "|"
+                 << std::setw(30) << medicalItems[i] << std::endl;
+        }
+    }
+
+private:
+    int findCategoryIndex(const std::string &category) const
+    {
+        for (size_t i = 0; i < wasteMap.size(); ++i)
+        {
+            if (wasteMap[i].category == category)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+};
+
+#endif
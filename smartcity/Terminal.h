@@ -0,0 +1,92 @@
+// smartcity/Terminal.h
+// Portable console input. Replaces the Windows-only <conio.h> password prompt:
+// echo is switched off through termios on POSIX and _getch() on Windows. When
+// stdin is not a terminal (a pipe or a batch run) input is read as plain lines.
+#ifndef SMARTCITY_TERMINAL_H
+#define SMARTCITY_TERMINAL_H
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#ifdef _WIN32
+#include <conio.h>
+#include <io.h>
+#else
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+inline bool stdinIsTerminal()
+{
+#ifdef _WIN32
+    return _isatty(_fileno(stdin)) != 0;
+#else
+    return isatty(STDIN_FILENO) != 0;
+#endif
+}
+
+// Reads one line without echoing it, printing '*' per character typed
+inline std::string readHiddenLine()
+{
+    std::string text;
+    if (!stdinIsTerminal())
+    {
+        std::getline(std::cin, text);
+        if (!text.empty() && text.back() == '\r')
+            text.pop_back();
+        return text;
+    }
+
+#ifdef _WIN32
+    int ch;
+    while ((ch = _getch()) != '\r' && ch != EOF)
+    {
+        if (ch == '\b')
+        {
+            if (!text.empty())
+            {
+                std::cout << "\b \b";
+                text.pop_back();
+            }
+        }
+        else
+        {
+            std::cout << '*';
+            text += (char)ch;
+        }
+    }
+#else
+    std::cout.flush();
+    termios saved;
+    tcgetattr(STDIN_FILENO, &saved);
+    termios raw = saved;
+    raw.c_lflag &= ~(ICANON | ECHO);
+    raw.c_cc[VMIN] = 1;
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+
+    char ch;
+    while (std::cin.get(ch) && ch != '\n' && ch != '\r')
+    {
+        if (ch == '\b' || ch == 127) // Backspace or Delete
+        {
+            if (!text.empty())
+            {
+                std::cout << "\b \b" << std::flush;
+                text.pop_back();
+            }
+        }
+        else
+        {
+            std::cout << '*' << std::flush;
+            text += ch;
+        }
+    }
+    tcsetattr(STDIN_FILENO, TCSANOW, &saved);
+#endif
+    std::cout << std::endl;
+    return text;
+}
+
+#endif
@@ -0,0 +1,332 @@
+// smartcity/Volume_prediction.h
+// Waste Volume Prediction System: history per location and 3 month forecasts.
+#ifndef SMARTCITY_VOLUME_PREDICTION_H
+#define SMARTCITY_VOLUME_PREDICTION_H
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../Write_ahead_log.h"
+#include "Instrumentation.h"
+
+//  Structure for waste volume data
+struct WasteData
+{
+    std::string date;
+    std::string location;
+    double volume;
+
+    WasteData(std::string d, std::string l, double v) : date(d), location(l), volume(v) {}
+};
+
+// Trie node for location-based searching
+struct TrieNode
+{
+    std::map<char, TrieNode *> children;
+    bool isEndOfWord;
+    std::vector<WasteData *> locationData;
+
+    TrieNode() : isEndOfWord(false) {}
+};
+
+// Waste Volume Prediction System class
+class WastePredictionSystem
+{
+private:
+    std::string legacyFile;
+    std::deque<WasteData> historicalData; // the trie points into it, so it must not reallocate
+    TrieNode *locationTrie;
+    const int NUM_BUCKETS = 10;
+    WalStore store; // one record per reading, keyed by walKey(its index in historicalData)
+
+    // Initialize Trie node
+    TrieNode *createNode()
+    {
+        return new TrieNode();
+    }
+
+    void freeTrie(TrieNode *node)
+    {
+        for (auto &child : node->children)
+        {
+            freeTrie(child.second);
+        }
+        delete node;
+    }
+
+    // Insert location into Trie
+    void insertLocation(std::string location, WasteData *data)
+    {
+        TrieNode *current = locationTrie;
+
+        for (char c : location)
+        {
+            if (current->children.find(c) == current->children.end())
+            {
+                current->children[c] = createNode();
+            }
+            current = current->children[c];
+        }
+
+        current->isEndOfWord = true;
+        current->locationData.push_back(data);
+    }
+
+    // Bucket Sort implementation
+    void bucketSort(std::vector<WasteData> &data)
+    {
+        if (data.empty())
+            return;
+
+        std::vector<std::vector<WasteData>> buckets(NUM_BUCKETS);
+
+        // Find range of volumes
+        double maxVol = data[0].volume;
+        double minVol = data[0].volume;
+        for (const auto &entry : data)
+        {
+            maxVol = std::max(maxVol, entry.volume);
+            minVol = std::min(minVol, entry.volume);
+        }
+
+        if (maxVol == minVol)
+        {
+            // All volumes are the same; no need to sort
+            return;
+        }
+
+        // Distribute into buckets
+        for (const auto &entry : data)
+        {
+            int bucketIndex = (int)((entry.volume - minVol) * NUM_BUCKETS / (maxVol - minVol + 1));
+            bucketIndex = std::min(bucketIndex, NUM_BUCKETS - 1);
+            buckets[bucketIndex].push_back(entry);
+        }
+
+        // Sort individual buckets
+        for (auto &bucket : buckets)
+        {
+            std::sort(bucket.begin(), bucket.end(),
+                 [](const WasteData &a, const WasteData &b)
+                 {
+                     return a.volume < b.volume;
+                 });
+        }
+
+        // Concatenate all buckets
+        data.clear();
+        for (const auto &bucket : buckets)
+        {
+            data.insert(data.end(), bucket.begin(), bucket.end());
+        }
+    }
+
+    static std::string encodeWasteData(const WasteData &data)
+    {
+        return RecordWriter().putString(data.date).putString(data.location).putDouble(data.volume).str();
+    }
+
+    // Readings are never removed, so the index is a stable key
+    void saveWasteDataToFile(WalStore::SnapshotWriter &out) const
+    {
+        static Histogram &saveTime = metrics().histogram("storage.waste_data.save");
+        ScopedTimer timer(saveTime);
+
+        for (size_t i = 0; i < historicalData.size(); i++)
+        {
+            out.put(walKey(i), encodeWasteData(historicalData[i]));
+        }
+    }
+
+    void restoreWasteData(const std::string &date, const std::string &location, double volume)
+    {
+        historicalData.emplace_back(date, location, volume);
+        insertLocation(location, &historicalData.back());
+    }
+
+    void loadWasteDataFromFile()
+    {
+        static Histogram &loadTime = metrics().histogram("storage.waste_data.load");
+        ScopedTimer timer(loadTime);
+
+        std::vector<std::pair<std::string, std::string>> records;
+        if (!store.open(records))
+        {
+            importWasteDataFromTextFile();
+            store.compact();
+            return;
+        }
+
+        // open() returns records in first-write order, which is index order here
+        for (const auto &record : records)
+        {
+            RecordReader in(record.second);
+            std::string date = in.getString();
+            std::string location = in.getString();
+            double volume = in.getDouble();
+            restoreWasteData(date, location, volume);
+        }
+    }
+
+    // One-time migration from the old comma-separated waste_data.txt, which
+    // the segregation module used to write as well
+    void importWasteDataFromTextFile()
+    {
+        std::ifstream inFile(legacyFile);
+        if (inFile.is_open())
+        {
+            std::string line;
+            while (std::getline(inFile, line))
+            {
+                size_t pos1 = line.find(',');
+                size_t pos2 = line.find(',', pos1 + 1);
+                if (pos1 == std::string::npos || pos2 == std::string::npos)
+                {
+                    continue; // the segregation module's lines in the shared file
+                }
+                std::string date = line.substr(0, pos1);
+                std::string location = line.substr(pos1 + 1, pos2 - pos1 - 1);
+                double volume = std::stod(line.substr(pos2 + 1));
+                restoreWasteData(date, location, volume);
+            }
+            inFile.close();
+        }
+    }
+
+public:
+    // Every addWasteData appends one record to <storeName>.wal; the constructor
+    // loads the snapshot and replays the log tail
+    explicit WastePredictionSystem(const std::string &storeName = "smartcity_waste_data",
+                                   const std::string &legacyFile = "waste_data.txt")
+        : legacyFile(legacyFile), locationTrie(createNode()),
+          store(storeName, [this](WalStore::SnapshotWriter &out) { saveWasteDataToFile(out); })
+    {
+        loadWasteDataFromFile();
+    }
+
+    ~WastePredictionSystem()
+    {
+        freeTrie(locationTrie);
+    }
+
+    // Folds the log into a fresh snapshot
+    bool compact()
+    {
+        return store.compact();
+    }
+
+    WastePredictionSystem(const WastePredictionSystem &) = delete;
+    WastePredictionSystem &operator=(const WastePredictionSystem &) = delete;
+
+    // Add new waste data
+    void addWasteData(std::string date, std::string location, double volume)
+    {
+        restoreWasteData(date, location, volume);
+        store.put(walKey(historicalData.size() - 1), encodeWasteData(historicalData.back()));
+    }
+
+    // Generate prediction for a location
+    std::vector<double> predictWasteVolume(std::string location)
+    {
+        static Histogram &forecastTime = metrics().histogram("forecast.predict_location");
+        ScopedTimer timer(forecastTime);
+
+        std::vector<double> predictions;
+        TrieNode *current = locationTrie;
+
+        // Find location in Trie
+        for (char c : location)
+        {
+            if (current->children.find(c) == current->children.end())
+            {
+                std::cout << "No data available for this location.\n";
+                return predictions;
+            }
+            current = current->children[c];
+        }
+
+        if (!current->isEndOfWord)
+        {
+            std::cout << "Location not found.\n";
+            return predictions;
+        }
+
+        // Access location history
+        std::vector<WasteData *> &locationHistory = current->locationData;
+        if (locationHistory.empty())
+        {
+            std::cout << "No historical data for the location.\n";
+            return predictions;
+        }
+
+        // Sort historical data
+        std::vector<WasteData> sortedData;
+        for (auto *data : locationHistory)
+        {
+            if (data)
+            {
+                sortedData.push_back(*data);
+            }
+        }
+
+        if (sortedData.empty())
+        {
+            std::cout << "Error: No valid historical data found.\n";
+            return predictions;
+        }
+
+        bucketSort(sortedData);
+
+        // Calculate predictions for the next 3 months
+        double avgVolume = 0;
+        for (const auto &data : sortedData)
+        {
+            avgVolume += data.volume;
+        }
+        avgVolume /= sortedData.size();
+
+        // Linear trend prediction
+        double trend = 0;
+        if (sortedData.size() > 1)
+        {
+            trend = (sortedData.back().volume - sortedData.front().volume) / (sortedData.size() - 1);
+        }
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            predictions.push_back(std::max(0.0, avgVolume + trend * i)); // Ensure non-negative predictions
+        }
+
+        return predictions;
+    }
+
+    // Generate forecast report
+    void generateForecastReport(std::string location)
+    {
+        std::vector<double> predictions = predictWasteVolume(location);
+        if (predictions.empty())
+        {
+            return;
+        }
+
+        std::cout << "\nWaste Volume Forecast Report for " << location << "\n";
+        std::cout << "----------------------------------------\n";
+        std::cout << "Predictions for the next 3 months:\n\n";
+
+        for (std::vector<double>::size_type i = 0; i < predictions.size(); i++)
+        {
+            std::cout << "Month " << (i + 1) << ": " << std::fixed << std::setprecision(2)
+                 << predictions[i] << " tons\n";
+        }
+
+        std::cout << "\nNote: Predictions are based on historical data and trends.\n";
+    }
+};
+
+#endif
@@ -0,0 +1,59 @@
+// smartcity/Waste_to_energy.h
+// Waste to Energy Conversion System: processing records and energy totals.
+#ifndef SMARTCITY_WASTE_TO_ENERGY_H
+#define SMARTCITY_WASTE_TO_ENERGY_H
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+//  Class for waste processing
+class Waste_Processing_System
+{
+public:
+    void loadRecords()
+    {
+        std::ifstream inFile("waste_records.txt");
+        if (inFile.is_open())
+        {
+            std::string line;
+            std::cout << "\nPast Waste Processing Records:\n";
+            std::cout << "----------------------------\n";
+            while (std::getline(inFile, line))
+            {
+                size_t pos1 = line.find(',');
+                size_t pos2 = line.find(',', pos1 + 1);
+                size_t pos3 = line.find(',', pos2 + 1);
+
+                std::string wasteType = line.substr(0, pos1);
+                float quantity = std::stof(line.substr(pos1 + 1, pos2 - pos1 - 1));
+                float energyGenerated = std::stof(line.substr(pos2 + 1, pos3 - pos2 - 1));
+                float totalEnergy = std::stof(line.substr(pos3 + 1));
+
+                std::cout << "Waste Type: " << wasteType << "\n";
+                std::cout << "Quantity: " << quantity << " tons\n";
+                std::cout << "Energy Generation Factor: " << energyGenerated << " MWh/ton\n";
+                std::cout << "Total Energy: " << totalEnergy << " MWh\n";
+                std::cout << "----------------------------\n";
+            }
+            inFile.close();
+        }
+        else
+        {
+            std::cerr << "No past records found.\n";
+        }
+    }
+
+    void saveRecord(const std::string &wasteType, float quantity, float energyGenerated, float totalEnergy)
+    {
+        std::ofstream outFile("waste_records.txt", std::ios::app);
+        if (outFile.is_open())
+        {
+            outFile << wasteType << "," << quantity << "," << energyGenerated << "," << totalEnergy << "\n";
+            outFile.close();
+        }
+    }
+};
+
+#endif